@@ -0,0 +1,247 @@
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../libraries/s21_containers.h"
+#include "../libraries/s21_containersplus.h"
+#include "bench_common.h"
+
+using S21Map = s21::map<int, int>;
+using StdMap = std::map<int, int>;
+using S21Set = s21::set<int>;
+using StdSet = std::set<int>;
+using S21Multiset = s21::multiset<int>;
+using StdMultiset = std::multiset<int>;
+using S21BTreeMap = s21::btree_map<int, int>;
+using S21BTreeSet = s21::btree_set<int>;
+using S21BTreeMultiset = s21::btree_multiset<int>;
+using S21FlatMap = s21::flat_map<int, int>;
+using S21FlatSet = s21::flat_set<int>;
+using S21UnorderedMap = s21::unordered_map<int, int>;
+using StdUnorderedMap = std::unordered_map<int, int>;
+using S21UnorderedSet = s21::unordered_set<int>;
+using StdUnorderedSet = std::unordered_set<int>;
+using S21UnorderedMultiset = s21::unordered_multiset<int>;
+using StdUnorderedMultiset = std::unordered_multiset<int>;
+
+namespace {
+
+// в мультимножество каждый ключ попадает дважды
+template <class C>
+constexpr int kKeyDivisor = 1;
+template <>
+constexpr int kKeyDivisor<S21Multiset> = 2;
+template <>
+constexpr int kKeyDivisor<StdMultiset> = 2;
+template <>
+constexpr int kKeyDivisor<S21BTreeMultiset> = 2;
+template <>
+constexpr int kKeyDivisor<S21UnorderedMultiset> = 2;
+template <>
+constexpr int kKeyDivisor<StdUnorderedMultiset> = 2;
+
+bench::Order order(const benchmark::State &state) {
+  return static_cast<bench::Order>(state.range(1));
+}
+
+// плоские контейнеры строятся целиком из диапазона: поэлементная вставка
+// в середину массива для 10^7 ключей заняла бы часы
+template <class C>
+C filled(const std::vector<int> &keys) {
+  if constexpr (std::is_same<C, S21FlatSet>::value) {
+    return C(keys.begin(), keys.end());
+  } else if constexpr (std::is_same<C, S21FlatMap>::value) {
+    std::vector<std::pair<int, int>> items;
+    items.reserve(keys.size());
+    for (int key : keys) items.emplace_back(key, key);
+    return C(items.begin(), items.end());
+  } else {
+    C c;
+    for (int key : keys) bench::insertKey(c, key / kKeyDivisor<C>);
+    return c;
+  }
+}
+
+template <class C, class = void>
+struct isHashed : std::false_type {};
+template <class C>
+struct isHashed<C, std::void_t<typename C::hasher>> : std::true_type {};
+
+// деревья очищаются с начала; в хеш-таблице begin() ищет первый занятый
+// слот, поэтому там удаление идёт по ключам в заданном порядке
+template <class C>
+void eraseAll(C &c, const std::vector<int> &keys) {
+  if constexpr (isHashed<C>::value) {
+    for (int key : keys) c.erase(key / kKeyDivisor<C>);
+  } else {
+    while (!c.empty()) c.erase(c.begin());
+  }
+}
+
+// построение вставками в заданном порядке и разрушение
+template <class C>
+void BM_Insert(benchmark::State &state) {
+  const std::vector<int> &keys = bench::keys(state.range(0), order(state));
+  for (auto _ : state) {
+    C c = filled<C>(keys);
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+// поиск всех ключей в том же порядке, в котором они вставлялись
+template <class C>
+void BM_Lookup(benchmark::State &state) {
+  const std::vector<int> &keys = bench::keys(state.range(0), order(state));
+  C c = filled<C>(keys);
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (int key : keys)
+      found += bench::containsKey(c, key / kKeyDivisor<C>);
+    benchmark::DoNotOptimize(found);
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+template <class C>
+void BM_Erase(benchmark::State &state) {
+  const std::vector<int> &keys = bench::keys(state.range(0), order(state));
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c = filled<C>(keys);
+    state.ResumeTiming();
+    eraseAll(c, keys);
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+// построение из диапазона: упорядоченный вход дерево собирает за O(n)
+template <class C>
+void BM_BuildRange(benchmark::State &state) {
+  const std::vector<int> &keys = bench::keys(state.range(0), order(state));
+  std::vector<typename C::value_type> items;
+  if constexpr (std::is_same<typename C::value_type, int>::value) {
+    items = keys;
+  } else {
+    for (int key : keys) items.emplace_back(key, key);
+  }
+  for (auto _ : state) {
+    C c(items.begin(), items.end());
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+// вставка с подсказкой end(): на упорядоченном входе без спуска от корня
+template <class C>
+void BM_InsertHinted(benchmark::State &state) {
+  const std::vector<int> &keys = bench::keys(state.range(0), order(state));
+  for (auto _ : state) {
+    C c;
+    for (int key : keys) {
+      if constexpr (std::is_same<typename C::value_type, int>::value) {
+        c.emplace_hint(c.end(), key);
+      } else {
+        c.emplace_hint(c.end(), key, key);
+      }
+    }
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+template <class C>
+void BM_Iterate(benchmark::State &state) {
+  C c = filled<C>(bench::keys(state.range(0), order(state)));
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) {
+      auto &&item = *it;
+      benchmark::DoNotOptimize(&item);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+template <class C>
+void BM_Copy(benchmark::State &state) {
+  C c = filled<C>(bench::keys(state.range(0), order(state)));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(&copy);
+  }
+  bench::setItems(state, state.range(0));
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+template <class C>
+void BM_Move(benchmark::State &state) {
+  C c = filled<C>(bench::keys(state.range(0), order(state)));
+  for (auto _ : state) {
+    C moved(std::move(c));
+    benchmark::DoNotOptimize(&moved);
+    c = std::move(moved);
+  }
+  state.SetLabel(bench::orderName(order(state)));
+}
+
+}  // namespace
+
+#define S21_BENCH_KEYED_ONE(func, type) \
+  BENCHMARK_TEMPLATE(func, type)         \
+      ->Apply(bench::keyedArgs)          \
+      ->Unit(benchmark::kMicrosecond)
+
+#define S21_BENCH_KEYED(func, s21_type, std_type) \
+  S21_BENCH_KEYED_ONE(func, s21_type);            \
+  S21_BENCH_KEYED_ONE(func, std_type)
+
+#define S21_BENCH_ALL_KEYED_ONE(type)   \
+  S21_BENCH_KEYED_ONE(BM_Insert, type);  \
+  S21_BENCH_KEYED_ONE(BM_Lookup, type);  \
+  S21_BENCH_KEYED_ONE(BM_Erase, type);   \
+  S21_BENCH_KEYED_ONE(BM_Iterate, type); \
+  S21_BENCH_KEYED_ONE(BM_Copy, type);    \
+  S21_BENCH_KEYED_ONE(BM_Move, type)
+
+#define S21_BENCH_ALL_KEYED(s21_type, std_type) \
+  S21_BENCH_ALL_KEYED_ONE(s21_type);            \
+  S21_BENCH_ALL_KEYED_ONE(std_type)
+
+S21_BENCH_ALL_KEYED(S21Map, StdMap);
+S21_BENCH_ALL_KEYED(S21Set, StdSet);
+S21_BENCH_ALL_KEYED(S21Multiset, StdMultiset);
+S21_BENCH_KEYED(BM_BuildRange, S21Map, StdMap);
+S21_BENCH_KEYED(BM_BuildRange, S21Set, StdSet);
+S21_BENCH_KEYED(BM_BuildRange, S21Multiset, StdMultiset);
+S21_BENCH_KEYED(BM_InsertHinted, S21Map, StdMap);
+S21_BENCH_KEYED(BM_InsertHinted, S21Set, StdSet);
+
+// B-деревья сравниваются с теми же std::map, std::set и std::multiset
+S21_BENCH_ALL_KEYED_ONE(S21BTreeMap);
+S21_BENCH_ALL_KEYED_ONE(S21BTreeSet);
+S21_BENCH_ALL_KEYED_ONE(S21BTreeMultiset);
+S21_BENCH_ALL_KEYED(S21UnorderedMap, StdUnorderedMap);
+S21_BENCH_ALL_KEYED(S21UnorderedSet, StdUnorderedSet);
+S21_BENCH_ALL_KEYED(S21UnorderedMultiset, StdUnorderedMultiset);
+
+// для плоских контейнеров BM_Insert - это построение из диапазона;
+// аналоги из std уже зарегистрированы выше
+S21_BENCH_KEYED_ONE(BM_Insert, S21FlatMap);
+S21_BENCH_KEYED_ONE(BM_Lookup, S21FlatMap);
+S21_BENCH_KEYED_ONE(BM_Iterate, S21FlatMap);
+S21_BENCH_KEYED_ONE(BM_Copy, S21FlatMap);
+S21_BENCH_KEYED_ONE(BM_Insert, S21FlatSet);
+S21_BENCH_KEYED_ONE(BM_Lookup, S21FlatSet);
+S21_BENCH_KEYED_ONE(BM_Iterate, S21FlatSet);
+S21_BENCH_KEYED_ONE(BM_Copy, S21FlatSet);
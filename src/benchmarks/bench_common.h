@@ -0,0 +1,98 @@
+#ifndef S21_BENCH_COMMON_H
+#define S21_BENCH_COMMON_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+// размеры от 10 до 10^7 с шагом в порядок
+constexpr std::int64_t kMinSize = 10;
+constexpr std::int64_t kMaxSize = 10'000'000;
+
+// порядок, в котором ключи подаются в ассоциативные контейнеры
+enum class Order : std::int64_t { kSorted, kReverse, kRandom };
+
+inline const char *orderName(Order order) {
+  switch (order) {
+    case Order::kSorted:
+      return "sorted";
+    case Order::kReverse:
+      return "reverse";
+    default:
+      return "random";
+  }
+}
+
+// ключи 0..n-1 в заданном порядке; последний набор кешируется, чтобы
+// генерация 10^7 ключей не повторялась в каждом бенчмарке
+inline const std::vector<int> &keys(std::int64_t n, Order order) {
+  static std::vector<int> cached;
+  static std::int64_t cached_n = -1;
+  static Order cached_order = Order::kSorted;
+  if (n != cached_n || order != cached_order) {
+    cached.resize(n);
+    std::iota(cached.begin(), cached.end(), 0);
+    if (order == Order::kReverse) {
+      std::reverse(cached.begin(), cached.end());
+    } else if (order == Order::kRandom) {
+      std::shuffle(cached.begin(), cached.end(), std::mt19937(21));
+    }
+    cached_n = n;
+    cached_order = order;
+  }
+  return cached;
+}
+
+inline void sequenceArgs(benchmark::internal::Benchmark *b) {
+  for (std::int64_t n = kMinSize; n <= kMaxSize; n *= 10) b->Arg(n);
+}
+
+inline void keyedArgs(benchmark::internal::Benchmark *b) {
+  for (std::int64_t n = kMinSize; n <= kMaxSize; n *= 10) {
+    for (Order order : {Order::kSorted, Order::kReverse, Order::kRandom})
+      b->Args({n, static_cast<std::int64_t>(order)});
+  }
+}
+
+template <class C, class = void>
+struct hasContains : std::false_type {};
+template <class C>
+struct hasContains<C, std::void_t<decltype(std::declval<C &>().contains(0))>>
+    : std::true_type {};
+
+// общий интерфейс для s21 и std: у std::map нет contains в C++17,
+// а в map вставляется пара
+template <class C>
+void insertKey(C &c, int key) {
+  if constexpr (std::is_same<typename C::value_type,
+                              typename C::key_type>::value) {
+    c.insert(key);
+  } else {
+    c.insert({key, key});
+  }
+}
+
+template <class C>
+bool containsKey(C &c, int key) {
+  if constexpr (hasContains<C>::value) {
+    return c.contains(key);
+  } else {
+    return c.find(key) != c.end();
+  }
+}
+
+inline void setItems(benchmark::State &state, std::int64_t n) {
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+}  // namespace bench
+
+#endif  // S21_BENCH_COMMON_H
@@ -0,0 +1,253 @@
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <stack>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_containersplus.h"
+#include "bench_common.h"
+
+namespace {
+
+// очередь под мьютексом - точка отсчёта для очередей без блокировок
+class MutexQueue {
+ public:
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    items_.push(value);
+    return true;
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (items_.empty()) return false;
+    out = items_.front();
+    items_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<int> items_;
+};
+
+// стек под мьютексом для сравнения с ConcurrentStack
+class MutexStack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    items_.push(value);
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (items_.empty()) return false;
+    out = items_.top();
+    items_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::stack<int> items_;
+};
+
+// s21::map под одним shared_mutex: так отображение делят потоки сейчас
+class LockedMap {
+ public:
+  void insert_or_assign(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    items_.insert_or_assign(key, value);
+  }
+  bool contains(int key) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return items_.contains(key);
+  }
+
+ private:
+  mutable std::shared_mutex mutex_;
+  mutable s21::map<int, int> items_;
+};
+
+using S21ConcurrentMap = s21::concurrent_map<int, int>;
+using S21SnapshotMap = s21::snapshot_map<int, int>;
+using S21ConcurrentStack = s21::ConcurrentStack<int>;
+using S21SpscQueue = s21::SpscQueue<int, 1024>;
+using S21MpmcQueue = s21::MpmcQueue<int, 1024>;
+
+// n элементов от производителя к потребителю в соседнем потоке; на
+// неудаче поток уступает ядро, иначе на одном ядре он крутится весь квант
+template <class Q>
+void BM_ProducerConsumer(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    Q queue;
+    std::thread consumer([&queue, n] {
+      int value = 0;
+      for (std::int64_t got = 0; got < n;) {
+        if (queue.try_pop(value)) {
+          ++got;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+      benchmark::DoNotOptimize(value);
+    });
+    for (std::int64_t i = 0; i < n;) {
+      if (queue.try_push(static_cast<int>(i))) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    consumer.join();
+  }
+  bench::setItems(state, n);
+}
+
+// то же пачками по 64: индексы публикуются раз на пачку
+void BM_ProducerConsumerBatched(benchmark::State &state) {
+  constexpr std::size_t kBatch = 64U;
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    S21SpscQueue queue;
+    std::thread consumer([&queue, n] {
+      int buffer[kBatch];
+      for (std::int64_t got = 0; got < n;) {
+        std::size_t popped = queue.pop_n(buffer, kBatch);
+        if (popped == 0U) std::this_thread::yield();
+        got += static_cast<std::int64_t>(popped);
+      }
+      benchmark::DoNotOptimize(buffer);
+    });
+    int batch[kBatch] = {};
+    for (std::int64_t i = 0; i < n;) {
+      std::size_t count = static_cast<std::size_t>(
+          std::min<std::int64_t>(static_cast<std::int64_t>(kBatch), n - i));
+      std::size_t pushed = queue.push_n(batch, count);
+      if (pushed == 0U) std::this_thread::yield();
+      i += static_cast<std::int64_t>(pushed);
+    }
+    consumer.join();
+  }
+  bench::setItems(state, n);
+}
+
+// 2^20 элементов через очередь; range(0) производителей и столько же
+// потребителей
+template <class Q>
+void BM_ManyProducersConsumers(benchmark::State &state) {
+  constexpr std::int64_t kItems = 1 << 20;
+  std::int64_t sides = state.range(0);
+  std::int64_t per_thread = kItems / sides;
+  for (auto _ : state) {
+    Q queue;
+    std::vector<std::thread> threads;
+    for (std::int64_t t = 0; t < sides; ++t) {
+      threads.emplace_back([&queue, per_thread] {
+        for (std::int64_t i = 0; i < per_thread;) {
+          if (queue.try_push(static_cast<int>(i))) {
+            ++i;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+      });
+      threads.emplace_back([&queue, per_thread] {
+        int value = 0;
+        for (std::int64_t got = 0; got < per_thread;) {
+          if (queue.try_pop(value)) {
+            ++got;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+        benchmark::DoNotOptimize(value);
+      });
+    }
+    for (std::thread &worker : threads) worker.join();
+  }
+  bench::setItems(state, per_thread * sides);
+}
+
+// стек как общий список свободных буферов: каждый из range(0) потоков
+// 2^20 / range(0) раз кладёт буфер и забирает обратно
+template <class S>
+void BM_StackPushPop(benchmark::State &state) {
+  constexpr std::int64_t kItems = 1 << 20;
+  std::int64_t workers = state.range(0);
+  std::int64_t per_thread = kItems / workers;
+  for (auto _ : state) {
+    S stack;
+    std::vector<std::thread> threads;
+    for (std::int64_t t = 0; t < workers; ++t) {
+      threads.emplace_back([&stack, per_thread] {
+        int value = 0;
+        for (std::int64_t i = 0; i < per_thread; ++i) {
+          stack.push(static_cast<int>(i));
+          stack.try_pop(value);
+        }
+        benchmark::DoNotOptimize(value);
+      });
+    }
+    for (std::thread &worker : threads) worker.join();
+  }
+  bench::setItems(state, per_thread * workers);
+}
+
+// range(0) потоков; каждая WriteEvery-я операция - запись, остальные -
+// поиск
+template <class M, std::int64_t WriteEvery>
+void BM_MapReads(benchmark::State &state) {
+  constexpr std::int64_t kOps = 1 << 20;
+  constexpr int kKeys = 1 << 16;
+  std::int64_t workers = state.range(0);
+  std::int64_t per_thread = kOps / workers;
+  M map;
+  for (int key = 0; key < kKeys; key += 2) map.insert_or_assign(key, key);
+  const std::vector<int> &order = bench::keys(kKeys, bench::Order::kRandom);
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (std::int64_t t = 0; t < workers; ++t) {
+      threads.emplace_back([&map, &order, per_thread, t] {
+        std::int64_t found = 0;
+        for (std::int64_t i = 0; i < per_thread; ++i) {
+          int key = order[(i + t * per_thread) % kKeys];
+          if (i % WriteEvery == 0) {
+            map.insert_or_assign(key, key);
+          } else {
+            found += map.contains(key);
+          }
+        }
+        benchmark::DoNotOptimize(found);
+      });
+    }
+    for (std::thread &worker : threads) worker.join();
+  }
+  bench::setItems(state, per_thread * workers);
+}
+
+void threadArgs(benchmark::internal::Benchmark *b) {
+  for (std::int64_t sides = 1; sides <= 8; sides *= 2) b->Arg(sides);
+  b->UseRealTime();
+}
+
+void concurrentArgs(benchmark::internal::Benchmark *b) {
+  for (std::int64_t n = 1000; n <= 1'000'000; n *= 10) b->Arg(n);
+  b->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, S21SpscQueue)->Apply(concurrentArgs);
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, MutexQueue)->Apply(concurrentArgs);
+BENCHMARK(BM_ProducerConsumerBatched)->Apply(concurrentArgs);
+BENCHMARK_TEMPLATE(BM_ManyProducersConsumers, S21MpmcQueue)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_ManyProducersConsumers, MutexQueue)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_StackPushPop, S21ConcurrentStack)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_StackPushPop, MutexStack)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_MapReads, S21ConcurrentMap, 10)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_MapReads, LockedMap, 10)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_MapReads, S21SnapshotMap, 1000)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_MapReads, S21ConcurrentMap, 1000)->Apply(threadArgs);
+BENCHMARK_TEMPLATE(BM_MapReads, LockedMap, 1000)->Apply(threadArgs);
@@ -0,0 +1,346 @@
+#include <array>
+#include <deque>
+#include <list>
+#include <memory>
+#include <queue>
+#include <stack>
+#include <vector>
+
+#include "../libraries/s21_containers.h"
+#include "../libraries/s21_containersplus.h"
+#include "bench_common.h"
+
+using S21Vector = s21::Vector<int>;
+using StdVector = std::vector<int>;
+using S21List = s21::List<int>;
+using StdList = std::list<int>;
+using S21Deque = s21::Deque<int>;
+using StdDeque = std::deque<int>;
+using S21Stack = s21::Stack<int>;
+using StdStack = std::stack<int>;
+using S21Queue = s21::Queue<int>;
+using StdQueue = std::queue<int>;
+template <std::size_t N>
+using S21Array = s21::Array<int, N>;
+template <std::size_t N>
+using StdArray = std::array<int, N>;
+
+namespace {
+
+// у s21::Deque нет конструктора от размера, поэтому дек в обеих
+// реализациях строится через push_back
+template <class C>
+struct sizedCtor : std::false_type {};
+template <>
+struct sizedCtor<S21Vector> : std::true_type {};
+template <>
+struct sizedCtor<StdVector> : std::true_type {};
+template <>
+struct sizedCtor<S21List> : std::true_type {};
+template <>
+struct sizedCtor<StdList> : std::true_type {};
+
+template <class C>
+C filled(std::int64_t n) {
+  if constexpr (sizedCtor<C>::value) {
+    return C(n);
+  } else {
+    C c;
+    for (std::int64_t i = 0; i < n; ++i) c.push_back(i);
+    return c;
+  }
+}
+
+template <class C>
+C filledAdapter(std::int64_t n) {
+  C c;
+  for (std::int64_t i = 0; i < n; ++i) c.push(i);
+  return c;
+}
+
+template <class C, class = void>
+struct isAdapter : std::false_type {};
+template <class C>
+struct isAdapter<C, std::void_t<decltype(std::declval<C &>().push(0))>>
+    : std::true_type {};
+
+template <class C>
+C anyFilled(std::int64_t n) {
+  if constexpr (isAdapter<C>::value) {
+    return filledAdapter<C>(n);
+  } else {
+    return filled<C>(n);
+  }
+}
+
+// построение и разрушение контейнера из n элементов
+template <class C>
+void BM_Construct(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    C c = filled<C>(n);
+    benchmark::DoNotOptimize(&*c.begin());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_PushBack(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    C c;
+    for (std::int64_t i = 0; i < n; ++i) c.push_back(i);
+    benchmark::DoNotOptimize(&c.back());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_PushFront(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    C c;
+    for (std::int64_t i = 0; i < n; ++i) c.push_front(i);
+    benchmark::DoNotOptimize(&c.front());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_Push(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    C c = filledAdapter<C>(n);
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, n);
+}
+
+// произвольный доступ по индексам в случайном порядке
+template <class C>
+void BM_IndexLookup(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  C c = filled<C>(n);
+  const std::vector<int> &order = bench::keys(n, bench::Order::kRandom);
+  for (auto _ : state) {
+    long sum = 0;
+    for (int i : order) sum += c[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  bench::setItems(state, n);
+}
+
+// линейный поиск значения, которого нет в контейнере
+template <class C>
+void BM_FindLookup(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  C c = filled<C>(n);
+  for (auto _ : state) {
+    auto it = c.begin();
+    while (it != c.end() && *it != -1) ++it;
+    benchmark::DoNotOptimize(it == c.end());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_PopBack(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c = filled<C>(n);
+    state.ResumeTiming();
+    for (std::int64_t i = 0; i < n; ++i) c.pop_back();
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_PopFront(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c = filled<C>(n);
+    state.ResumeTiming();
+    for (std::int64_t i = 0; i < n; ++i) c.pop_front();
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_Pop(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c = filledAdapter<C>(n);
+    state.ResumeTiming();
+    for (std::int64_t i = 0; i < n; ++i) c.pop();
+    benchmark::DoNotOptimize(c.size());
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_Iterate(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  C c = filled<C>(n);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  bench::setItems(state, n);
+}
+
+template <class C>
+void BM_Copy(benchmark::State &state) {
+  std::int64_t n = state.range(0);
+  C c = anyFilled<C>(n);
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(&copy);
+  }
+  bench::setItems(state, n);
+}
+
+// перемещение туда и обратно, чтобы не пересобирать источник
+template <class C>
+void BM_Move(benchmark::State &state) {
+  C c = anyFilled<C>(state.range(0));
+  for (auto _ : state) {
+    C moved(std::move(c));
+    benchmark::DoNotOptimize(&moved);
+    c = std::move(moved);
+  }
+}
+
+// Array живёт в куче: 10^7 элементов не помещаются на стек. new A без
+// скобок, чтобы std::array не обнулялся, в отличие от s21::Array
+template <class A>
+std::unique_ptr<A> filledArray() {
+  std::unique_ptr<A> a(new A);
+  a->fill(1);
+  return a;
+}
+
+template <class A>
+void BM_ArrayFill(benchmark::State &state) {
+  for (auto _ : state) {
+    auto a = filledArray<A>();
+    benchmark::DoNotOptimize(a->data());
+  }
+  bench::setItems(state, sizeof(A) / sizeof(int));
+}
+
+template <class A>
+void BM_ArrayIndexLookup(benchmark::State &state) {
+  auto a = filledArray<A>();
+  const std::vector<int> &order =
+      bench::keys(a->size(), bench::Order::kRandom);
+  for (auto _ : state) {
+    long sum = 0;
+    for (int i : order) sum += (*a)[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  bench::setItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayIterate(benchmark::State &state) {
+  auto a = filledArray<A>();
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = a->begin(); it != a->end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  bench::setItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayCopy(benchmark::State &state) {
+  auto a = filledArray<A>();
+  for (auto _ : state) {
+    std::unique_ptr<A> copy(new A(*a));
+    benchmark::DoNotOptimize(copy->data());
+  }
+  bench::setItems(state, a->size());
+}
+
+template <class A>
+void BM_ArrayMove(benchmark::State &state) {
+  auto a = filledArray<A>();
+  for (auto _ : state) {
+    std::unique_ptr<A> moved(new A(std::move(*a)));
+    benchmark::DoNotOptimize(moved->data());
+  }
+  bench::setItems(state, a->size());
+}
+
+}  // namespace
+
+// регистрирует бенчмарк для s21-контейнера и его аналога из std
+#define S21_BENCH_PAIR(func, s21_type, std_type)                            \
+  BENCHMARK_TEMPLATE(func, s21_type)                                        \
+      ->Apply(bench::sequenceArgs)                                          \
+      ->Unit(benchmark::kMicrosecond);                                      \
+  BENCHMARK_TEMPLATE(func, std_type)                                        \
+      ->Apply(bench::sequenceArgs)                                          \
+      ->Unit(benchmark::kMicrosecond)
+
+#define S21_BENCH_ARRAY(n)                                                   \
+  BENCHMARK_TEMPLATE(BM_ArrayFill, S21Array<n>);                             \
+  BENCHMARK_TEMPLATE(BM_ArrayFill, StdArray<n>);                             \
+  BENCHMARK_TEMPLATE(BM_ArrayIndexLookup, S21Array<n>);                      \
+  BENCHMARK_TEMPLATE(BM_ArrayIndexLookup, StdArray<n>);                      \
+  BENCHMARK_TEMPLATE(BM_ArrayIterate, S21Array<n>);                          \
+  BENCHMARK_TEMPLATE(BM_ArrayIterate, StdArray<n>);                          \
+  BENCHMARK_TEMPLATE(BM_ArrayCopy, S21Array<n>);                             \
+  BENCHMARK_TEMPLATE(BM_ArrayCopy, StdArray<n>);                             \
+  BENCHMARK_TEMPLATE(BM_ArrayMove, S21Array<n>);                             \
+  BENCHMARK_TEMPLATE(BM_ArrayMove, StdArray<n>)
+
+S21_BENCH_PAIR(BM_Construct, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_PushBack, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_IndexLookup, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_PopBack, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_Iterate, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_Copy, S21Vector, StdVector);
+S21_BENCH_PAIR(BM_Move, S21Vector, StdVector);
+
+S21_BENCH_PAIR(BM_Construct, S21List, StdList);
+S21_BENCH_PAIR(BM_PushBack, S21List, StdList);
+S21_BENCH_PAIR(BM_PushFront, S21List, StdList);
+S21_BENCH_PAIR(BM_FindLookup, S21List, StdList);
+S21_BENCH_PAIR(BM_PopFront, S21List, StdList);
+S21_BENCH_PAIR(BM_Iterate, S21List, StdList);
+S21_BENCH_PAIR(BM_Copy, S21List, StdList);
+S21_BENCH_PAIR(BM_Move, S21List, StdList);
+
+S21_BENCH_PAIR(BM_Construct, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_PushBack, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_PushFront, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_IndexLookup, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_PopFront, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_Iterate, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_Copy, S21Deque, StdDeque);
+S21_BENCH_PAIR(BM_Move, S21Deque, StdDeque);
+
+S21_BENCH_PAIR(BM_Push, S21Stack, StdStack);
+S21_BENCH_PAIR(BM_Pop, S21Stack, StdStack);
+S21_BENCH_PAIR(BM_Copy, S21Stack, StdStack);
+S21_BENCH_PAIR(BM_Move, S21Stack, StdStack);
+
+S21_BENCH_PAIR(BM_Push, S21Queue, StdQueue);
+S21_BENCH_PAIR(BM_Pop, S21Queue, StdQueue);
+S21_BENCH_PAIR(BM_Copy, S21Queue, StdQueue);
+S21_BENCH_PAIR(BM_Move, S21Queue, StdQueue);
+
+S21_BENCH_ARRAY(10);
+S21_BENCH_ARRAY(100);
+S21_BENCH_ARRAY(1000);
+S21_BENCH_ARRAY(10000);
+S21_BENCH_ARRAY(100000);
+S21_BENCH_ARRAY(1000000);
+S21_BENCH_ARRAY(10000000);
@@ -0,0 +1,662 @@
+#ifndef S21_BTREE_H
+#define S21_BTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Узел B-дерева: значения лежат подряд в одном блоке. Лист хранит только
+// их, внутренний узел (BTreeInternal) - ещё count + 1 указателей на детей
+template <class Value, std::size_t N>
+struct BTreeNode {
+  Value *slot(std::size_t i) {
+    return reinterpret_cast<Value *>(storage) + i;
+  }
+  const Value *slot(std::size_t i) const {
+    return reinterpret_cast<const Value *>(storage) + i;
+  }
+
+  BTreeNode *parent{};
+  std::uint16_t position{};  // номер среди детей родителя
+  std::uint16_t count{};
+  bool leaf{true};
+  alignas(Value) unsigned char storage[N * sizeof(Value)];
+};
+
+template <class Value, std::size_t N>
+struct BTreeInternal : BTreeNode<Value, N> {
+  BTreeNode<Value, N> *children[N + 1];
+};
+
+// B-дерево поиска. Узел занимает несколько кеш-линий, поэтому поиск
+// читает один блок на уровень вместо узла на каждое сравнение. Внутри узла
+// ключи-числа с std::less перебираются линейно без ветвлений (цикл
+// векторизуется), остальные - бинарным поиском. Multi разрешает равные
+// ключи: новый ключ встаёт после равных ему. Любая вставка или удаление
+// делает итераторы недействительными.
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+class BTree {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  static constexpr size_type kNodeBytes = 256U;
+  static constexpr size_type kSlots =
+      (kNodeBytes - 2U * sizeof(void *)) / sizeof(Value) > 3U
+          ? (kNodeBytes - 2U * sizeof(void *)) / sizeof(Value)
+          : 3U;
+  // кроме корня, узел не бывает заполнен меньше чем наполовину
+  static constexpr size_type kMinSlots = (kSlots - 1U) / 2U;
+
+  template <bool IsConst>
+  class BTreeIterator;
+  using iterator = BTreeIterator<false>;
+  using const_iterator = BTreeIterator<true>;
+
+ private:
+  using bnode = BTreeNode<Value, kSlots>;
+  using binternal = BTreeInternal<Value, kSlots>;
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  using value_allocator = typename alloc_traits::template rebind_alloc<Value>;
+  using value_traits = std::allocator_traits<value_allocator>;
+  using leaf_allocator = typename alloc_traits::template rebind_alloc<bnode>;
+  using leaf_traits = std::allocator_traits<leaf_allocator>;
+  using internal_allocator =
+      typename alloc_traits::template rebind_alloc<binternal>;
+  using internal_traits = std::allocator_traits<internal_allocator>;
+
+  static constexpr bool kLinearSearch =
+      std::is_arithmetic<Key>::value &&
+      (std::is_same<Compare, std::less<Key>>::value ||
+       std::is_same<Compare, std::less<>>::value);
+
+ public:
+  BTree() = default;
+  explicit BTree(const Compare &comp,
+                 const allocator_type &alloc = allocator_type())
+      : comp_(comp), alloc_(alloc) {}
+  explicit BTree(const allocator_type &alloc) : alloc_(alloc) {}
+  BTree(const BTree &other)
+      : comp_(other.comp_),
+        alloc_(value_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    if (other.root_) root_ = copyNode(other.root_);
+    size_ = other.size_;
+  }
+  BTree(BTree &&other) noexcept { swapTree(other); }
+  ~BTree() { clear(); }
+
+  BTree &operator=(BTree &&other) noexcept {
+    swapTree(other);
+    return *this;
+  }
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+  key_compare key_comp() const { return comp_; }
+
+  iterator begin() noexcept { return iterator(leftmost(), 0U); }
+  iterator end() noexcept { return iterator(root_, root_ ? root_->count : 0U); }
+  const_iterator begin() const noexcept {
+    return const_iterator(leftmost(), 0U);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(root_, root_ ? root_->count : 0U);
+  }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Value) / 2U;
+  }
+
+  void clear() noexcept {
+    if (root_) destroyNode(root_);
+    root_ = nullptr;
+    size_ = 0U;
+  }
+  void erase(const_iterator pos) { eraseAt(pos.node_, pos.pos_); }
+  size_type erase(const Key &key);
+
+  iterator find(const Key &key) { return findPosition(key); }
+  const_iterator find(const Key &key) const { return findPosition(key); }
+  bool contains(const Key &key) const {
+    return const_iterator(findPosition(key)) != end();
+  }
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) { return bound<false>(key); }
+  const_iterator lower_bound(const Key &key) const {
+    return bound<false>(key);
+  }
+  iterator upper_bound(const Key &key) { return bound<true>(key); }
+  const_iterator upper_bound(const Key &key) const { return bound<true>(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ protected:
+  static const Key &keyOf(const Value &value) { return KeyOf()(value); }
+
+  // вставляет, только если ключа ещё нет; second == false - ключ найден
+  template <class... Args>
+  std::pair<iterator, bool> insertUnique(const Key &key, Args &&...args);
+  // вставка после всех равных ключей
+  template <class V>
+  iterator insertMulti(V &&value);
+
+  void swapTree(BTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+ private:
+  static bnode *child(const bnode *node, size_type i) noexcept {
+    return static_cast<const binternal *>(node)->children[i];
+  }
+  static void setChild(bnode *node, size_type i, bnode *kid) noexcept {
+    static_cast<binternal *>(node)->children[i] = kid;
+    kid->parent = node;
+    kid->position = static_cast<std::uint16_t>(i);
+  }
+
+  bnode *leftmost() const noexcept {
+    bnode *node = root_;
+    if (node)
+      while (!node->leaf) node = child(node, 0U);
+    return node;
+  }
+  // число значений узла, меньших key (Upper: не больших key)
+  template <bool Upper>
+  size_type searchNode(const bnode *node, const Key &key) const;
+  template <bool Upper>
+  iterator bound(const Key &key) const;
+  iterator findPosition(const Key &key) const;
+
+  template <class... Args>
+  iterator insertAt(bnode *node, size_type i, Args &&...args);
+  void splitFor(bnode *&node, size_type &i);
+  void eraseAt(bnode *node, size_type i);
+  void rebalance(bnode *node);
+  void rotateRight(bnode *parent, size_type k);
+  void rotateLeft(bnode *parent, size_type k);
+  void mergeChildren(bnode *parent, size_type k);
+
+  // переносит значение в неинициализированный слот
+  void relocate(Value *to, Value *from) {
+    value_traits::construct(alloc_, to, std::move(*from));
+    value_traits::destroy(alloc_, from);
+  }
+  // сдвигает значения с позиции i и детей правее i на одну позицию вправо
+  void shiftRight(bnode *node, size_type i);
+
+  bnode *newNode(bool leaf);
+  void freeNode(bnode *node) noexcept;
+  bnode *copyNode(const bnode *other);
+  void destroyNode(bnode *node) noexcept;
+
+  bnode *root_{};
+  size_type size_{};
+  Compare comp_{};
+  value_allocator alloc_;
+};
+
+// двунаправленный итератор: узел и позиция в нём. end() - позиция за
+// последним значением корня; из неё -- спускается к максимуму
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <bool IsConst>
+class BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::BTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Value;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const Value *, Value *>;
+  using reference = std::conditional_t<IsConst, const Value &, Value &>;
+
+  BTreeIterator() = default;
+  BTreeIterator(bnode *node, size_type pos) : node_(node), pos_(pos) {}
+  operator BTreeIterator<true>() const { return {node_, pos_}; }
+
+  reference operator*() const { return *node_->slot(pos_); }
+  pointer operator->() const { return node_->slot(pos_); }
+
+  BTreeIterator &operator++() {
+    if (!node_->leaf) {
+      node_ = child(node_, pos_ + 1U);
+      while (!node_->leaf) node_ = child(node_, 0U);
+      pos_ = 0U;
+      return *this;
+    }
+    ++pos_;
+    while (pos_ == node_->count && node_->parent) {
+      pos_ = node_->position;
+      node_ = node_->parent;
+    }
+    return *this;
+  }
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  BTreeIterator &operator--() {
+    if (!node_->leaf) {
+      node_ = child(node_, pos_);
+      while (!node_->leaf) node_ = child(node_, node_->count);
+      pos_ = node_->count - 1U;
+      return *this;
+    }
+    while (pos_ == 0U && node_->parent) {
+      pos_ = node_->position;
+      node_ = node_->parent;
+    }
+    --pos_;
+    return *this;
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const BTreeIterator &other) const {
+    return node_ == other.node_ && pos_ == other.pos_;
+  }
+  bool operator!=(const BTreeIterator &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class BTree;
+  bnode *node_{};
+  size_type pos_{};
+};
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::size_type
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::erase(const Key &key) {
+  size_type removed = 0U;
+  for (iterator pos = find(key); pos != end(); pos = find(key)) {
+    eraseAt(pos.node_, pos.pos_);
+    ++removed;
+    if (!Multi) break;
+  }
+  return removed;
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::size_type
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::count(
+    const Key &key) const {
+  if (!Multi) return contains(key) ? 1U : 0U;
+  size_type result = 0U;
+  const_iterator last = upper_bound(key);
+  for (const_iterator it = lower_bound(key); it != last; ++it) ++result;
+  return result;
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <bool Upper>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::size_type
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::searchNode(
+    const bnode *node, const Key &key) const {
+  if constexpr (kLinearSearch) {
+    size_type result = 0U;
+    for (size_type i = 0; i < node->count; ++i) {
+      const Key &item = keyOf(*node->slot(i));
+      result += Upper ? !(key < item) : item < key;
+    }
+    return result;
+  } else {
+    size_type lo = 0U, hi = node->count;
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2U;
+      const Key &item = keyOf(*node->slot(mid));
+      if (Upper ? !comp_(key, item) : comp_(item, key)) {
+        lo = mid + 1U;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+}
+
+// в поддереве ребёнка i все ключи меньше ключа i, поэтому кандидат,
+// найденный глубже, точнее найденного выше
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <bool Upper>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::iterator
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::bound(
+    const Key &key) const {
+  iterator result(root_, root_ ? root_->count : 0U);
+  for (bnode *node = root_; node;) {
+    size_type i = searchNode<Upper>(node, key);
+    if (i < node->count) result = iterator(node, i);
+    if (node->leaf) break;
+    node = child(node, i);
+  }
+  return result;
+}
+
+// в дереве без повторов поиск останавливается на первом равном ключе
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::iterator
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::findPosition(
+    const Key &key) const {
+  iterator last(root_, root_ ? root_->count : 0U);
+  if (Multi) {
+    iterator pos = bound<false>(key);
+    return pos == last || comp_(key, keyOf(*pos)) ? last : pos;
+  }
+  for (bnode *node = root_; node;) {
+    size_type i = searchNode<false>(node, key);
+    if (i < node->count && !comp_(key, keyOf(*node->slot(i))))
+      return iterator(node, i);
+    if (node->leaf) break;
+    node = child(node, i);
+  }
+  return last;
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <class... Args>
+std::pair<typename BTree<Key, Value, KeyOf, Compare, Allocator,
+                         Multi>::iterator,
+          bool>
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::insertUnique(
+    const Key &key, Args &&...args) {
+  if (root_ == nullptr) root_ = newNode(true);
+  bnode *node = root_;
+  size_type i;
+  while (true) {
+    i = searchNode<false>(node, key);
+    if (i < node->count && !comp_(key, keyOf(*node->slot(i))))
+      return {iterator(node, i), false};
+    if (node->leaf) break;
+    node = child(node, i);
+  }
+  return {insertAt(node, i, std::forward<Args>(args)...), true};
+}
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <class V>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::iterator
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::insertMulti(V &&value) {
+  if (root_ == nullptr) root_ = newNode(true);
+  bnode *node = root_;
+  size_type i = searchNode<true>(node, keyOf(value));
+  while (!node->leaf) {
+    node = child(node, i);
+    i = searchNode<true>(node, keyOf(value));
+  }
+  return insertAt(node, i, std::forward<V>(value));
+}
+
+// Новое значение всегда попадает в лист. Оно строится до splitFor и
+// shiftRight: args могут ссылаться на значения самого дерева, которые
+// те переносят
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+template <class... Args>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::iterator
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::insertAt(
+    bnode *node, size_type i, Args &&...args) {
+  alignas(Value) unsigned char buffer[sizeof(Value)];
+  auto *value = reinterpret_cast<Value *>(buffer);
+  value_traits::construct(alloc_, value, std::forward<Args>(args)...);
+  try {
+    if (node->count == kSlots) splitFor(node, i);
+  } catch (...) {
+    value_traits::destroy(alloc_, value);
+    throw;
+  }
+  shiftRight(node, i);
+  try {
+    relocate(node->slot(i), value);
+  } catch (...) {
+    value_traits::destroy(alloc_, value);
+    for (size_type j = i; j < node->count; ++j)
+      relocate(node->slot(j), node->slot(j + 1U));
+    throw;
+  }
+  ++node->count;
+  ++size_;
+  return iterator(node, i);
+}
+
+// Освобождает место в полном узле перед вставкой в позицию i: правая
+// половина уходит в новый соседний узел, средний ключ - в родителя
+// (полный родитель делится раньше). node и i указывают, куда вставлять.
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::splitFor(
+    bnode *&node, size_type &i) {
+  bnode *parent = node->parent;
+  size_type pos = node->position;
+  if (parent == nullptr) {
+    parent = newNode(false);
+    setChild(parent, 0U, node);
+    root_ = parent;
+  } else if (parent->count == kSlots) {
+    splitFor(parent, pos);
+  }
+  constexpr size_type middle = kSlots / 2U;
+  bnode *sibling = newNode(node->leaf);
+  for (size_type j = middle + 1U; j < kSlots; ++j)
+    relocate(sibling->slot(j - middle - 1U), node->slot(j));
+  if (!node->leaf)
+    for (size_type j = middle + 1U; j <= kSlots; ++j)
+      setChild(sibling, j - middle - 1U, child(node, j));
+  sibling->count = kSlots - middle - 1U;
+  shiftRight(parent, pos);
+  relocate(parent->slot(pos), node->slot(middle));
+  setChild(parent, pos + 1U, sibling);
+  ++parent->count;
+  node->count = middle;
+  if (i > middle) {
+    node = sibling;
+    i -= middle + 1U;
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::shiftRight(
+    bnode *node, size_type i) {
+  for (size_type j = node->count; j > i; --j)
+    relocate(node->slot(j), node->slot(j - 1U));
+  if (!node->leaf)
+    for (size_type j = node->count + 1U; j > i + 1U; --j)
+      setChild(node, j, child(node, j - 1U));
+}
+
+// значение во внутреннем узле заменяется предшественником из листа,
+// так что удаление всегда уменьшает лист
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::eraseAt(
+    bnode *node, size_type i) {
+  value_traits::destroy(alloc_, node->slot(i));
+  if (node->leaf) {
+    for (size_type j = i + 1U; j < node->count; ++j)
+      relocate(node->slot(j - 1U), node->slot(j));
+  } else {
+    bnode *leaf = child(node, i);
+    while (!leaf->leaf) leaf = child(leaf, leaf->count);
+    relocate(node->slot(i), leaf->slot(leaf->count - 1U));
+    node = leaf;
+  }
+  --node->count;
+  --size_;
+  rebalance(node);
+}
+
+// недобор в узле закрывается ключом соседа через родителя, а если соседи
+// сами заполнены минимально - слиянием, которое может уйти вверх
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::rebalance(
+    bnode *node) {
+  while (node != root_ && node->count < kMinSlots) {
+    bnode *parent = node->parent;
+    size_type pos = node->position;
+    if (pos > 0U && child(parent, pos - 1U)->count > kMinSlots) {
+      rotateRight(parent, pos - 1U);
+      return;
+    }
+    if (pos < parent->count && child(parent, pos + 1U)->count > kMinSlots) {
+      rotateLeft(parent, pos);
+      return;
+    }
+    mergeChildren(parent, pos > 0U ? pos - 1U : pos);
+    node = parent;
+  }
+  if (root_->count == 0U) {
+    bnode *old = root_;
+    root_ = old->leaf ? nullptr : child(old, 0U);
+    if (root_) root_->parent = nullptr;
+    freeNode(old);
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::rotateRight(
+    bnode *parent, size_type k) {
+  bnode *left = child(parent, k), *right = child(parent, k + 1U);
+  for (size_type j = right->count; j > 0U; --j)
+    relocate(right->slot(j), right->slot(j - 1U));
+  relocate(right->slot(0U), parent->slot(k));
+  relocate(parent->slot(k), left->slot(left->count - 1U));
+  if (!right->leaf) {
+    for (size_type j = right->count + 1U; j > 0U; --j)
+      setChild(right, j, child(right, j - 1U));
+    setChild(right, 0U, child(left, left->count));
+  }
+  --left->count;
+  ++right->count;
+}
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::rotateLeft(
+    bnode *parent, size_type k) {
+  bnode *left = child(parent, k), *right = child(parent, k + 1U);
+  relocate(left->slot(left->count), parent->slot(k));
+  relocate(parent->slot(k), right->slot(0U));
+  for (size_type j = 1U; j < right->count; ++j)
+    relocate(right->slot(j - 1U), right->slot(j));
+  if (!left->leaf) {
+    setChild(left, left->count + 1U, child(right, 0U));
+    for (size_type j = 1U; j <= right->count; ++j)
+      setChild(right, j - 1U, child(right, j));
+  }
+  ++left->count;
+  --right->count;
+}
+// сливает детей k и k + 1 вместе с разделяющим их ключом родителя
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::mergeChildren(
+    bnode *parent, size_type k) {
+  bnode *left = child(parent, k), *right = child(parent, k + 1U);
+  size_type base = left->count + 1U;
+  relocate(left->slot(left->count), parent->slot(k));
+  for (size_type j = 0; j < right->count; ++j)
+    relocate(left->slot(base + j), right->slot(j));
+  if (!left->leaf)
+    for (size_type j = 0; j <= right->count; ++j)
+      setChild(left, base + j, child(right, j));
+  left->count += right->count + 1U;
+  freeNode(right);
+  for (size_type j = k + 1U; j < parent->count; ++j)
+    relocate(parent->slot(j - 1U), parent->slot(j));
+  for (size_type j = k + 2U; j <= parent->count; ++j)
+    setChild(parent, j - 1U, child(parent, j));
+  --parent->count;
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::bnode *
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::newNode(bool leaf) {
+  bnode *node;
+  if (leaf) {
+    leaf_allocator alloc(alloc_);
+    node = ::new (static_cast<void *>(leaf_traits::allocate(alloc, 1U))) bnode;
+  } else {
+    internal_allocator alloc(alloc_);
+    node = ::new (static_cast<void *>(internal_traits::allocate(alloc, 1U)))
+        binternal;
+    node->leaf = false;
+  }
+  return node;
+}
+// значения узла к этому моменту уже разрушены или перенесены
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::freeNode(
+    bnode *node) noexcept {
+  if (node->leaf) {
+    leaf_allocator alloc(alloc_);
+    leaf_traits::deallocate(alloc, node, 1U);
+  } else {
+    internal_allocator alloc(alloc_);
+    internal_traits::deallocate(alloc, static_cast<binternal *>(node), 1U);
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+typename BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::bnode *
+BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::copyNode(
+    const bnode *other) {
+  bnode *node = newNode(other->leaf);
+  for (; node->count < other->count; ++node->count)
+    value_traits::construct(alloc_, node->slot(node->count),
+                            *other->slot(node->count));
+  if (!node->leaf)
+    for (size_type j = 0; j <= other->count; ++j)
+      setChild(node, j, copyNode(child(other, j)));
+  return node;
+}
+template <class Key, class Value, class KeyOf, class Compare, class Allocator,
+          bool Multi>
+void BTree<Key, Value, KeyOf, Compare, Allocator, Multi>::destroyNode(
+    bnode *node) noexcept {
+  for (size_type j = 0; j < node->count; ++j)
+    value_traits::destroy(alloc_, node->slot(j));
+  if (!node->leaf)
+    for (size_type j = 0; j <= node->count; ++j)
+      destroyNode(child(node, j));
+  freeNode(node);
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_H
@@ -0,0 +1,16 @@
+#ifndef S21_CACHE_LINE_H
+#define S21_CACHE_LINE_H
+
+#include <cstddef>
+
+namespace s21 {
+
+// Размер строки кеша. Данные, которые пишут разные потоки, разносятся по
+// разным строкам, иначе ядра перетягивают строку друг у друга на каждой
+// записи. std::hardware_destructive_interference_size в gcc зависит от
+// флагов -march, поэтому значение задано явно
+inline constexpr std::size_t kCacheLine = 64U;
+
+}  // namespace s21
+
+#endif  // S21_CACHE_LINE_H
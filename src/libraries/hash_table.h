@@ -0,0 +1,510 @@
+#ifndef S21_HASH_TABLE_H
+#define S21_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Байт метаданных слота: заполненный слот хранит 7 младших бит хеша (H2),
+// служебные значения отрицательны и не совпадают ни с одним H2.
+using ctrl_t = std::int8_t;
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+constexpr ctrl_t kSentinel = -1;
+constexpr std::size_t kGroupWidth = 16U;
+
+// Маска совпадений в группе: бит i соответствует слоту offset + i
+class BitMask {
+ public:
+  explicit BitMask(std::uint32_t mask) : mask_(mask) {}
+  explicit operator bool() const { return mask_ != 0U; }
+  std::size_t lowest() const { return __builtin_ctz(mask_); }
+  std::size_t trailingZeros() const {
+    return mask_ ? __builtin_ctz(mask_) : kGroupWidth;
+  }
+  std::size_t leadingZeros() const {
+    return mask_ ? __builtin_clz(mask_) - (32U - kGroupWidth) : kGroupWidth;
+  }
+  void clearLowest() { mask_ &= mask_ - 1U; }
+
+ private:
+  std::uint32_t mask_;
+};
+
+// 16 байт метаданных, сравниваемые за одну SSE2-инструкцию
+struct Group {
+#if defined(__SSE2__)
+  explicit Group(const ctrl_t *pos)
+      : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+  BitMask match(ctrl_t h2) const {
+    return BitMask(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+  }
+  BitMask matchEmpty() const { return match(kEmpty); }
+  // kEmpty и kDeleted меньше kSentinel, заполненные слоты - больше
+  BitMask matchEmptyOrDeleted() const {
+    return BitMask(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl)));
+  }
+
+  __m128i ctrl;
+#else
+  explicit Group(const ctrl_t *pos) { std::memcpy(ctrl, pos, kGroupWidth); }
+  BitMask match(ctrl_t h2) const {
+    std::uint32_t mask = 0U;
+    for (std::size_t i = 0; i < kGroupWidth; ++i)
+      if (ctrl[i] == h2) mask |= 1U << i;
+    return BitMask(mask);
+  }
+  BitMask matchEmpty() const { return match(kEmpty); }
+  BitMask matchEmptyOrDeleted() const {
+    std::uint32_t mask = 0U;
+    for (std::size_t i = 0; i < kGroupWidth; ++i)
+      if (ctrl[i] < kSentinel) mask |= 1U << i;
+    return BitMask(mask);
+  }
+
+  ctrl_t ctrl[kGroupWidth];
+#endif
+};
+
+// Хеш-таблица с открытой адресацией в духе SwissTable. Ёмкость имеет вид
+// 2^k - 1; за метаданными слотов лежит kSentinel и копия первых 15 байт,
+// чтобы группа, начатая у конца таблицы, читалась одной загрузкой.
+// Пробирование идёт по группам с треугольным шагом. KeyOf достаёт ключ
+// из хранимого значения: сам ключ для множеств, first для пар.
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+class HashTable {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  template <bool IsConst>
+  class HashIterator;
+  using iterator = HashIterator<false>;
+  using const_iterator = HashIterator<true>;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  using slot_allocator = typename alloc_traits::template rebind_alloc<Value>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+  using ctrl_allocator = typename alloc_traits::template rebind_alloc<ctrl_t>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+
+  static constexpr size_type kMinCapacity = kGroupWidth - 1U;
+
+ public:
+  HashTable() = default;
+  explicit HashTable(size_type bucket_count, const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual(),
+                     const allocator_type &alloc = allocator_type())
+      : hash_(hash), equal_(equal), alloc_(alloc) {
+    if (bucket_count) resize(normalizeCapacity(bucket_count));
+  }
+  explicit HashTable(const allocator_type &alloc) : alloc_(alloc) {}
+  HashTable(const HashTable &other)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        max_load_(other.max_load_),
+        alloc_(slot_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    reserve(other.size_);
+    for (const auto &value : other) insertNew(hashOf(value), value);
+  }
+  HashTable(HashTable &&other) noexcept { swapTable(other); }
+  ~HashTable() { destroyAll(); }
+
+  HashTable &operator=(HashTable &&other) noexcept {
+    swapTable(other);
+    return *this;
+  }
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  iterator begin() noexcept { return iteratorAt(firstFull()); }
+  iterator end() noexcept { return iteratorAt(capacity_); }
+  const_iterator begin() const noexcept { return iteratorAt(firstFull()); }
+  const_iterator end() const noexcept { return iteratorAt(capacity_); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (sizeof(Value) + 1U) / 2U;
+  }
+
+  void clear() noexcept;
+
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0F;
+  }
+  float max_load_factor() const noexcept { return max_load_; }
+  // верхняя граница - 15/16: в каждой группе должен оставаться пустой слот
+  void max_load_factor(float ml);
+  // ёмкость не меньше count и достаточная для текущих элементов
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+ protected:
+  static constexpr size_type kNotFound = std::numeric_limits<size_type>::max();
+
+  static const Key &keyOf(const Value &value) { return KeyOf()(value); }
+  size_type hashOf(const Value &value) const { return hashKey(keyOf(value)); }
+  // хеш пользователя перемешивается: std::hash для целых - тождество,
+  // и последовательные ключи иначе попали бы в одну группу
+  size_type hashKey(const Key &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_type>(h ^ (h >> 32U));
+  }
+  static size_type h1(size_type hash) { return hash >> 7U; }
+  static ctrl_t h2(size_type hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+  iterator iteratorAt(size_type i) noexcept {
+    return iterator(ctrl_ + i, slots_ + i);
+  }
+  const_iterator iteratorAt(size_type i) const noexcept {
+    return const_iterator(ctrl_ + i, slots_ + i);
+  }
+  size_type indexOf(const_iterator pos) const noexcept {
+    return pos.slot_ - slots_;
+  }
+  iterator findIterator(const Key &key) {
+    size_type i = findIndex(key);
+    return i == kNotFound ? end() : iteratorAt(i);
+  }
+  const_iterator findIterator(const Key &key) const {
+    size_type i = findIndex(key);
+    return i == kNotFound ? end() : iteratorAt(i);
+  }
+
+  size_type findIndex(const Key &key, size_type hash) const;
+  size_type findIndex(const Key &key) const {
+    return findIndex(key, hashKey(key));
+  }
+  // вставка без проверки на дубликат; возвращает индекс нового слота
+  template <class... Args>
+  size_type insertNew(size_type hash, Args &&...args);
+  // вставляет, только если ключа ещё нет; second == false - ключ найден
+  template <class... Args>
+  std::pair<size_type, bool> insertUnique(const Key &key, Args &&...args);
+  void eraseAt(size_type i) noexcept;
+
+  void swapTable(HashTable &other) noexcept;
+
+ private:
+  // число слотов, которые можно занять до перестройки
+  size_type growthLimit(size_type capacity) const {
+    size_type limit = static_cast<size_type>(capacity * max_load_);
+    return limit < capacity ? limit : capacity - 1U;
+  }
+  // ёмкость, при которой count элементов не превышают max_load_factor
+  size_type minCapacityFor(size_type count) const {
+    return static_cast<size_type>(count / max_load_) + 1U;
+  }
+  static size_type normalizeCapacity(size_type n) {
+    size_type capacity = kMinCapacity;
+    while (capacity < n) capacity = capacity * 2U + 1U;
+    return capacity;
+  }
+  size_type firstFull() const noexcept {
+    if (size_ == 0U) return capacity_;
+    size_type i = 0;
+    while (ctrl_[i] < kSentinel) ++i;
+    return i;
+  }
+  void setCtrl(size_type i, ctrl_t h) noexcept {
+    ctrl_[i] = h;
+    ctrl_[((i - (kGroupWidth - 1U)) & capacity_) + (kGroupWidth - 1U)] = h;
+  }
+  size_type findFirstNonFull(size_type hash) const;
+  void resize(size_type new_capacity);
+  void growOrCleanup();
+  void destroyAll() noexcept;
+
+  ctrl_t *ctrl_{};
+  Value *slots_{};
+  size_type capacity_{};
+  size_type size_{};
+  size_type growth_left_{};
+  Hash hash_{};
+  KeyEqual equal_{};
+  float max_load_{0.875F};
+  slot_allocator alloc_;
+};
+
+// прямой итератор по занятым слотам; пустые и удалённые слоты пропускаются,
+// kSentinel за последним слотом останавливает обход
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+template <bool IsConst>
+class HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::HashIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Value;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const Value *, Value *>;
+  using reference = std::conditional_t<IsConst, const Value &, Value &>;
+
+  HashIterator() = default;
+  HashIterator(const ctrl_t *ctrl, pointer slot) : ctrl_(ctrl), slot_(slot) {}
+  operator HashIterator<true>() const { return {ctrl_, slot_}; }
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  HashIterator &operator++() {
+    do {
+      ++ctrl_;
+      ++slot_;
+    } while (*ctrl_ < kSentinel);
+    return *this;
+  }
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  bool operator==(const HashIterator &other) const {
+    return slot_ == other.slot_;
+  }
+  bool operator!=(const HashIterator &other) const {
+    return slot_ != other.slot_;
+  }
+
+ private:
+  friend class HashTable;
+  const ctrl_t *ctrl_{};
+  pointer slot_{};
+};
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::clear() noexcept {
+  if (capacity_ == 0U) return;
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) slot_traits::destroy(alloc_, slots_ + i);
+  }
+  std::memset(ctrl_, kEmpty, capacity_ + kGroupWidth);
+  ctrl_[capacity_] = kSentinel;
+  size_ = 0U;
+  growth_left_ = growthLimit(capacity_);
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::max_load_factor(
+    float ml) {
+  if (!(ml > 0.0F)) return;
+  max_load_ = ml < 0.9375F ? ml : 0.9375F;
+  if (capacity_) resize(normalizeCapacity(minCapacityFor(size_)));
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::rehash(
+    size_type count) {
+  if (size_ == 0U && count == 0U) {
+    destroyAll();
+    return;
+  }
+  size_type needed = minCapacityFor(size_);
+  size_type new_capacity = normalizeCapacity(count < needed ? needed : count);
+  if (new_capacity != capacity_) resize(new_capacity);
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  if (count > size_ + growth_left_)
+    resize(normalizeCapacity(minCapacityFor(count)));
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::findIndex(
+    const Key &key, size_type hash) const {
+  if (size_ == 0U) return kNotFound;
+  size_type offset = h1(hash) & capacity_;
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    Group group(ctrl_ + offset);
+    for (BitMask match = group.match(h2(hash)); match; match.clearLowest()) {
+      size_type i = (offset + match.lowest()) & capacity_;
+      if (equal_(keyOf(slots_[i]), key)) return i;
+    }
+    // пустой слот обрывает цепочку: дальше ключ вставлен быть не мог
+    if (group.matchEmpty()) return kNotFound;
+    offset = (offset + step) & capacity_;
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+typename HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::findFirstNonFull(
+    size_type hash) const {
+  size_type offset = h1(hash) & capacity_;
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    BitMask free = Group(ctrl_ + offset).matchEmptyOrDeleted();
+    if (free) return (offset + free.lowest()) & capacity_;
+    offset = (offset + step) & capacity_;
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+template <class... Args>
+typename HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::size_type
+HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::insertNew(
+    size_type hash, Args &&...args) {
+  if (capacity_ == 0U) resize(kMinCapacity);
+  size_type i = findFirstNonFull(hash);
+  // удалённый слот можно занять без роста; пустой расходует запас
+  if (growth_left_ == 0U && ctrl_[i] != kDeleted) {
+    growOrCleanup();
+    i = findFirstNonFull(hash);
+  }
+  slot_traits::construct(alloc_, slots_ + i, std::forward<Args>(args)...);
+  if (ctrl_[i] == kEmpty) --growth_left_;
+  setCtrl(i, h2(hash));
+  ++size_;
+  return i;
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+template <class... Args>
+std::pair<typename HashTable<Key, Value, KeyOf, Hash, KeyEqual,
+                             Allocator>::size_type,
+          bool>
+HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::insertUnique(
+    const Key &key, Args &&...args) {
+  size_type hash = hashKey(key);
+  size_type i = findIndex(key, hash);
+  if (i != kNotFound) return {i, false};
+  return {insertNew(hash, std::forward<Args>(args)...), true};
+}
+
+// слот помечается пустым, если ни одна цепочка поиска не могла пройти
+// через него: вокруг него уже есть пустые слоты ближе, чем ширина группы
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::eraseAt(
+    size_type i) noexcept {
+  slot_traits::destroy(alloc_, slots_ + i);
+  --size_;
+  size_type before = (i - kGroupWidth) & capacity_;
+  BitMask empty_after = Group(ctrl_ + i).matchEmpty();
+  BitMask empty_before = Group(ctrl_ + before).matchEmpty();
+  bool was_never_full =
+      empty_before && empty_after &&
+      empty_after.trailingZeros() + empty_before.leadingZeros() < kGroupWidth;
+  setCtrl(i, was_never_full ? kEmpty : kDeleted);
+  if (was_never_full) ++growth_left_;
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::swapTable(
+    HashTable &other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+  std::swap(max_load_, other.max_load_);
+  std::swap(alloc_, other.alloc_);
+}
+
+// если место съели удалённые слоты, таблица перестраивается в той же
+// ёмкости; иначе ёмкость удваивается
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::growOrCleanup() {
+  if (size_ * 2U <= growthLimit(capacity_)) {
+    resize(capacity_);
+  } else {
+    resize(capacity_ * 2U + 1U);
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual, Allocator>::resize(
+    size_type new_capacity) {
+  ctrl_allocator ctrl_alloc(alloc_);
+  size_type ctrl_size = new_capacity + kGroupWidth;
+  ctrl_t *new_ctrl = ctrl_traits::allocate(ctrl_alloc, ctrl_size);
+  Value *new_slots;
+  try {
+    new_slots = slot_traits::allocate(alloc_, new_capacity);
+  } catch (...) {
+    ctrl_traits::deallocate(ctrl_alloc, new_ctrl, ctrl_size);
+    throw;
+  }
+  std::memset(new_ctrl, kEmpty, ctrl_size);
+  new_ctrl[new_capacity] = kSentinel;
+
+  ctrl_t *old_ctrl = ctrl_;
+  Value *old_slots = slots_;
+  size_type old_capacity = capacity_;
+  ctrl_ = new_ctrl;
+  slots_ = new_slots;
+  capacity_ = new_capacity;
+  growth_left_ = growthLimit(new_capacity) - size_;
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] < 0) continue;
+    size_type hash = hashOf(old_slots[i]);
+    size_type target = findFirstNonFull(hash);
+    slot_traits::construct(alloc_, slots_ + target,
+                           std::move_if_noexcept(old_slots[i]));
+    slot_traits::destroy(alloc_, old_slots + i);
+    setCtrl(target, h2(hash));
+  }
+  if (old_capacity) {
+    ctrl_traits::deallocate(ctrl_alloc, old_ctrl, old_capacity + kGroupWidth);
+    slot_traits::deallocate(alloc_, old_slots, old_capacity);
+  }
+}
+
+template <class Key, class Value, class KeyOf, class Hash, class KeyEqual,
+          class Allocator>
+void HashTable<Key, Value, KeyOf, Hash, KeyEqual,
+               Allocator>::destroyAll() noexcept {
+  if (capacity_ == 0U) return;
+  clear();
+  ctrl_allocator ctrl_alloc(alloc_);
+  ctrl_traits::deallocate(ctrl_alloc, ctrl_, capacity_ + kGroupWidth);
+  slot_traits::deallocate(alloc_, slots_, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = growth_left_ = 0U;
+}
+
+}  // namespace s21
+
+#endif  // S21_HASH_TABLE_H
@@ -0,0 +1,24 @@
+#ifndef S21_KEY_OF_H
+#define S21_KEY_OF_H
+
+#include <utility>
+
+namespace s21 {
+
+// Достают ключ из хранимого значения: сам ключ у множеств, first у пар
+
+template <class Key>
+struct IdentityKey {
+  const Key &operator()(const Key &value) const { return value; }
+};
+
+template <class K, class T>
+struct PairKey {
+  const K &operator()(const std::pair<const K, T> &value) const {
+    return value.first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_KEY_OF_H
@@ -0,0 +1,248 @@
+#ifndef S21_NODE_POOL_H
+#define S21_NODE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Пул узлов: память выделяется слябами, освобождённые узлы попадают в
+// список свободных и переиспользуются при следующих вставках.
+// Слябы живут, пока на них ссылается хоть один пул: узел, переданный в
+// другое дерево, продолжает лежать в памяти исходного пула и после
+// освобождения возвращается в неё, а не в пул, где его удалили.
+template <class Node, class Allocator = std::allocator<Node>>
+class NodePool {
+  union Slot;
+  struct Storage;
+
+ public:
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using storage_ref = std::shared_ptr<Storage>;
+  // чьи слябы: 0 - собственные, i - i-е из принятых через adopt
+  using storage_id = std::uint32_t;
+
+  NodePool() = default;
+  explicit NodePool(const allocator_type &alloc) : alloc_(alloc) {}
+  NodePool(const NodePool &) = delete;
+  NodePool(NodePool &&other) noexcept { swap(other); }
+  NodePool &operator=(const NodePool &) = delete;
+  NodePool &operator=(NodePool &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+  ~NodePool() = default;
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+  template <class... Args>
+  Node *create(Args &&...args);
+  void destroy(Node *node) noexcept;
+  // узел из слябов id: чужая ячейка уходит пулу-владельцу через
+  // release и достанется ему при следующем create
+  void destroy(Node *node, storage_id id) noexcept;
+  // ячейка разрушенного узла возвращается в слябы storage; безопасно
+  // из любого потока, владелец может в это время работать с пулом
+  static void release(const storage_ref &storage, Node *node) noexcept;
+
+  // adopt принимает в пул узел из слябов storage и возвращает их номер;
+  // disown - узел с номером id ушёл из пула, не освобождаясь. Чужие
+  // слябы удерживаются, пока в пуле есть хоть один их узел, после чего
+  // номер переходит к следующим
+  [[nodiscard]] const storage_ref &owner(storage_id id) const {
+    return id == 0U ? storage_ : adopted_[id - 1U].storage;
+  }
+  storage_id adopt(const storage_ref &storage);
+  void disown(storage_id id) noexcept;
+
+  // гарантирует, что следующие n вызовов create не обратятся к new
+  void reserve(size_type n);
+  [[nodiscard]] size_type available() const noexcept {
+    return free_count_ + static_cast<size_type>(slab_end_ - cursor_);
+  }
+
+  void swap(NodePool &other) noexcept {
+    std::swap(storage_, other.storage_);
+    std::swap(adopted_, other.adopted_);
+    std::swap(free_, other.free_);
+    std::swap(free_count_, other.free_count_);
+    std::swap(cursor_, other.cursor_);
+    std::swap(slab_end_, other.slab_end_);
+    std::swap(next_slab_, other.next_slab_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+  using slot_allocator = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+  struct Storage {
+    explicit Storage(const slot_allocator &slot_alloc) : alloc(slot_alloc) {}
+    Storage(const Storage &) = delete;
+    Storage &operator=(const Storage &) = delete;
+    ~Storage() {
+      for (auto &slab : slabs)
+        slot_traits::deallocate(alloc, slab.first, slab.second);
+    }
+    std::vector<std::pair<Slot *, size_type>> slabs;
+    slot_allocator alloc;
+    // ячейки, освобождённые в других пулах; только пополняется, забирает
+    // их целиком владелец, поэтому ABA здесь нет
+    std::atomic<Slot *> returned{nullptr};
+  };
+  using node_allocator = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  static constexpr size_type kMinSlab = 16U;
+  static constexpr size_type kMaxSlab = 4096U;
+
+  void addSlab(size_type count);
+  bool takeReturned() noexcept;
+
+  storage_ref storage_;
+  struct Adopted {
+    storage_ref storage;  // пусто, если номер свободен
+    size_type nodes;      // сколько наших узлов лежит в этих слябах
+  };
+  std::vector<Adopted> adopted_;  // слябы других пулов с нашими узлами
+  Slot *free_{};
+  size_type free_count_{};
+  Slot *cursor_{};
+  Slot *slab_end_{};
+  size_type next_slab_{kMinSlab};
+  slot_allocator alloc_;
+};
+
+template <class Node, class Allocator>
+template <class... Args>
+Node *NodePool<Node, Allocator>::create(Args &&...args) {
+  Slot *slot;
+  if (free_ || takeReturned()) {
+    slot = free_;
+    free_ = free_->next;
+    --free_count_;
+  } else {
+    if (cursor_ == slab_end_) {
+      addSlab(next_slab_);
+      if (next_slab_ < kMaxSlab) next_slab_ *= 2U;
+    }
+    slot = cursor_++;
+  }
+  try {
+    node_allocator alloc(alloc_);
+    auto *node = reinterpret_cast<Node *>(slot->storage);
+    node_traits::construct(alloc, node, std::forward<Args>(args)...);
+    return node;
+  } catch (...) {
+    slot->next = free_;
+    free_ = slot;
+    ++free_count_;
+    throw;
+  }
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::destroy(Node *node) noexcept {
+  if (node == nullptr) return;
+  node_allocator alloc(alloc_);
+  node_traits::destroy(alloc, node);
+  auto *slot = reinterpret_cast<Slot *>(node);
+  slot->next = free_;
+  free_ = slot;
+  ++free_count_;
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::destroy(Node *node, storage_id id) noexcept {
+  if (id == 0U) return destroy(node);
+  node_allocator alloc(alloc_);
+  node_traits::destroy(alloc, node);
+  release(adopted_[id - 1U].storage, node);
+  disown(id);
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::release(const storage_ref &storage,
+                                        Node *node) noexcept {
+  auto *slot = reinterpret_cast<Slot *>(node);
+  slot->next = storage->returned.load(std::memory_order_relaxed);
+  while (!storage->returned.compare_exchange_weak(slot->next, slot,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+  }
+}
+
+// возвращённые ячейки забираются разом, только когда своих свободных нет
+template <class Node, class Allocator>
+bool NodePool<Node, Allocator>::takeReturned() noexcept {
+  if (!storage_ || !storage_->returned.load(std::memory_order_relaxed))
+    return false;
+  free_ = storage_->returned.exchange(nullptr, std::memory_order_acquire);
+  for (Slot *slot = free_; slot; slot = slot->next) ++free_count_;
+  return true;
+}
+
+template <class Node, class Allocator>
+typename NodePool<Node, Allocator>::storage_id
+NodePool<Node, Allocator>::adopt(const storage_ref &storage) {
+  if (!storage || storage == storage_) return 0U;
+  size_type vacant = adopted_.size();
+  for (size_type i = 0; i < adopted_.size(); ++i) {
+    if (adopted_[i].storage == storage) {
+      ++adopted_[i].nodes;
+      return static_cast<storage_id>(i + 1U);
+    }
+    if (!adopted_[i].storage && vacant == adopted_.size()) vacant = i;
+  }
+  if (vacant == adopted_.size()) {
+    adopted_.push_back({storage, 1U});
+  } else {
+    adopted_[vacant] = {storage, 1U};
+  }
+  return static_cast<storage_id>(vacant + 1U);
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::disown(storage_id id) noexcept {
+  if (id == 0U) return;
+  Adopted &held = adopted_[id - 1U];
+  if (--held.nodes == 0U) held.storage.reset();
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::reserve(size_type n) {
+  size_type have = available();
+  if (n > have) addSlab(n - have);
+}
+
+template <class Node, class Allocator>
+void NodePool<Node, Allocator>::addSlab(size_type count) {
+  if (!storage_) storage_ = std::make_shared<Storage>(alloc_);
+  auto &slabs = storage_->slabs;
+  slabs.reserve(slabs.size() + 1U);
+  // остаток текущего сляба не теряется, а уходит в список свободных
+  while (cursor_ != slab_end_) {
+    Slot *slot = cursor_++;
+    slot->next = free_;
+    free_ = slot;
+    ++free_count_;
+  }
+  slabs.emplace_back(slot_traits::allocate(alloc_, count), count);
+  cursor_ = slabs.back().first;
+  slab_end_ = cursor_ + count;
+}
+
+}  // namespace s21
+
+#endif  // S21_NODE_POOL_H
@@ -1,6 +1,10 @@
 #ifndef S21_ARRAY_H
 #define S21_ARRAY_H
 
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
 #include "s21_containers.h"
 
 namespace s21 {
@@ -26,18 +30,12 @@ class Array {
     }
   };
 
-  Array(const Array &v) : Array() {
-    for (size_type i = 0; i < N; ++i) {
-      arr[i] = v.arr[i];
-    }
-  };
+  Array(const Array &v) : Array() { copyFrom(v); };
 
   Array(Array &&v) : Array(v) { v.~Array(); };
 
   Array operator=(Array &&v) {
-    for (size_type i = 0; i < v.size(); ++i) {
-      arr[i] = v.arr[i];
-    }
+    copyFrom(v);
     return *this;
   }
 
@@ -70,12 +68,32 @@ class Array {
 
   void swap(Array &o) noexcept { std::swap(this->arr, o.arr); }
   void fill(const_reference value) {
-    for (size_type i = 0; i < N; ++i) {
-      arr[i] = value;
+    if constexpr (kTrivial && N != 0) {
+      // первый элемент размножается удвоением уже заполненного префикса
+      arr[0] = value;
+      for (size_type done = 1; done < N; done *= 2) {
+        std::memcpy(arr + done, arr, std::min(done, N - done) * sizeof(T));
+      }
+    } else {
+      for (size_type i = 0; i < N; ++i) {
+        arr[i] = value;
+      }
     }
   }
 
  private:
+  static constexpr bool kTrivial = std::is_trivially_copyable<T>::value;
+
+  void copyFrom(const Array &v) {
+    if constexpr (kTrivial) {
+      std::memcpy(arr, v.arr, sizeof(arr));
+    } else {
+      for (size_type i = 0; i < N; ++i) {
+        arr[i] = v.arr[i];
+      }
+    }
+  }
+
   value_type arr[N];
 };
 }  // namespace s21
@@ -0,0 +1,163 @@
+#ifndef S21_BTREE_MAP_H
+#define S21_BTREE_MAP_H
+
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+
+#include "btree.h"
+#include "key_of.h"
+
+namespace s21 {
+
+// Отображение на B-дереве с интерфейсом s21::map: пары лежат блоками по
+// узлу, поэтому поиск и обход больших деревьев реже промахиваются мимо кеша
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class btree_map : public BTree<K, std::pair<const K, T>, PairKey<K, T>,
+                               Compare, Allocator, false> {
+ public:
+  using BT = BTree<K, std::pair<const K, T>, PairKey<K, T>, Compare,
+                   Allocator, false>;
+  using allocator_type = Allocator;
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const K, T>;
+  using size_type = std::size_t;
+  using iterator = typename BT::iterator;
+  using const_iterator = typename BT::const_iterator;
+  using insert_result = std::pair<iterator, bool>;
+
+  btree_map() = default;
+  explicit btree_map(const Compare &comp,
+                     const allocator_type &alloc = allocator_type())
+      : BT(comp, alloc) {}
+  explicit btree_map(const allocator_type &alloc) : BT(alloc) {}
+  btree_map(std::initializer_list<value_type> const &items);
+  btree_map(const btree_map &other) = default;
+  btree_map(btree_map &&other) noexcept = default;
+  ~btree_map() = default;
+
+  btree_map &operator=(btree_map &&other) noexcept = default;
+
+  T &at(const K &key);
+  const T &at(const K &key) const;
+  T &operator[](const K &key);
+
+  insert_result insert(const value_type &value) {
+    return BT::insertUnique(value.first, value);
+  }
+  insert_result insert(const K &key, const T &value) {
+    return BT::insertUnique(key, key, value);
+  }
+  insert_result insert_or_assign(const K &key, const T &value);
+  template <class... Args>
+  insert_result emplace(Args &&...args);
+  void swap(btree_map &other) noexcept { BT::swapTree(other); }
+  void merge(btree_map &other);
+};
+
+// отображение на B-дереве с повторяющимися ключами
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class btree_multimap : public BTree<K, std::pair<const K, T>, PairKey<K, T>,
+                                    Compare, Allocator, true> {
+ public:
+  using BT = BTree<K, std::pair<const K, T>, PairKey<K, T>, Compare,
+                   Allocator, true>;
+  using allocator_type = Allocator;
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const K, T>;
+  using size_type = std::size_t;
+  using iterator = typename BT::iterator;
+  using const_iterator = typename BT::const_iterator;
+
+  btree_multimap() = default;
+  explicit btree_multimap(const Compare &comp,
+                          const allocator_type &alloc = allocator_type())
+      : BT(comp, alloc) {}
+  explicit btree_multimap(const allocator_type &alloc) : BT(alloc) {}
+  btree_multimap(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+  btree_multimap(const btree_multimap &other) = default;
+  btree_multimap(btree_multimap &&other) noexcept = default;
+  ~btree_multimap() = default;
+
+  btree_multimap &operator=(btree_multimap &&other) noexcept = default;
+
+  iterator insert(const value_type &value) { return BT::insertMulti(value); }
+  iterator insert(const K &key, const T &value) {
+    return BT::insertMulti(value_type(key, value));
+  }
+  template <class... Args>
+  iterator emplace(Args &&...args) {
+    return BT::insertMulti(value_type(std::forward<Args>(args)...));
+  }
+  void swap(btree_multimap &other) noexcept { BT::swapTree(other); }
+  // забирает все элементы other
+  void merge(btree_multimap &other) {
+    if (&other == this) return;
+    for (auto &item : other) BT::insertMulti(std::move(item));
+    other.clear();
+  }
+};
+
+template <class K, class T, class Compare, class Allocator>
+btree_map<K, T, Compare, Allocator>::btree_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) insert(item);
+}
+
+template <class K, class T, class Compare, class Allocator>
+T &btree_map<K, T, Compare, Allocator>::at(const K &key) {
+  iterator pos = BT::find(key);
+  if (pos == BT::end()) throw std::out_of_range("btree_map::at");
+  return pos->second;
+}
+template <class K, class T, class Compare, class Allocator>
+const T &btree_map<K, T, Compare, Allocator>::at(const K &key) const {
+  const_iterator pos = BT::find(key);
+  if (pos == BT::end()) throw std::out_of_range("btree_map::at");
+  return pos->second;
+}
+// один спуск: значение по умолчанию строится, только если ключа нет
+template <class K, class T, class Compare, class Allocator>
+T &btree_map<K, T, Compare, Allocator>::operator[](const K &key) {
+  return BT::insertUnique(key, std::piecewise_construct,
+                          std::forward_as_tuple(key), std::tuple<>())
+      .first->second;
+}
+
+template <class K, class T, class Compare, class Allocator>
+typename btree_map<K, T, Compare, Allocator>::insert_result
+btree_map<K, T, Compare, Allocator>::insert_or_assign(const K &key,
+                                                      const T &value) {
+  insert_result result = BT::insertUnique(key, key, value);
+  if (!result.second) result.first->second = value;
+  return result;
+}
+template <class K, class T, class Compare, class Allocator>
+template <class... Args>
+typename btree_map<K, T, Compare, Allocator>::insert_result
+btree_map<K, T, Compare, Allocator>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return BT::insertUnique(value.first, std::move(value));
+}
+
+// ключи, которые уже есть в *this, остаются в other. Вставка в B-дерево
+// сдвигает значения в узлах, поэтому остаток собирается в новое дерево
+template <class K, class T, class Compare, class Allocator>
+void btree_map<K, T, Compare, Allocator>::merge(btree_map &other) {
+  if (&other == this) return;
+  btree_map rest(other.key_comp(), other.get_allocator());
+  for (auto &item : other)
+    if (!BT::insertUnique(item.first, std::move(item)).second)
+      rest.insertUnique(item.first, std::move(item));
+  other.swap(rest);
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_MAP_H
@@ -0,0 +1,128 @@
+#ifndef S21_BTREE_SET_H
+#define S21_BTREE_SET_H
+
+#include <initializer_list>
+
+#include "btree.h"
+#include "key_of.h"
+
+namespace s21 {
+
+// Множество на B-дереве с интерфейсом s21::set. Итераторы константные:
+// изменённый ключ сломал бы порядок
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class btree_set
+    : public BTree<Key, Key, IdentityKey<Key>, Compare, Allocator, false> {
+ public:
+  using BT = BTree<Key, Key, IdentityKey<Key>, Compare, Allocator, false>;
+  using allocator_type = Allocator;
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using iterator = typename BT::const_iterator;
+  using const_iterator = typename BT::const_iterator;
+  using insert_result = std::pair<iterator, bool>;
+
+  btree_set() = default;
+  explicit btree_set(const Compare &comp,
+                     const allocator_type &alloc = allocator_type())
+      : BT(comp, alloc) {}
+  explicit btree_set(const allocator_type &alloc) : BT(alloc) {}
+  btree_set(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+  btree_set(const btree_set &other) = default;
+  btree_set(btree_set &&other) noexcept = default;
+  ~btree_set() = default;
+
+  btree_set &operator=(btree_set &&other) noexcept = default;
+
+  iterator begin() const noexcept { return BT::begin(); }
+  iterator end() const noexcept { return BT::end(); }
+
+  insert_result insert(const value_type &value) {
+    return BT::insertUnique(value, value);
+  }
+  template <class... Args>
+  insert_result emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return BT::insertUnique(value, std::move(value));
+  }
+  void swap(btree_set &other) noexcept { BT::swapTree(other); }
+  void merge(btree_set &other);
+
+  iterator find(const Key &key) const { return BT::find(key); }
+  iterator lower_bound(const Key &key) const { return BT::lower_bound(key); }
+  iterator upper_bound(const Key &key) const { return BT::upper_bound(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) const {
+    return BT::equal_range(key);
+  }
+};
+
+// множество на B-дереве с повторяющимися ключами
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class btree_multiset
+    : public BTree<Key, Key, IdentityKey<Key>, Compare, Allocator, true> {
+ public:
+  using BT = BTree<Key, Key, IdentityKey<Key>, Compare, Allocator, true>;
+  using allocator_type = Allocator;
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using iterator = typename BT::const_iterator;
+  using const_iterator = typename BT::const_iterator;
+  using pairiterator = std::pair<iterator, iterator>;
+
+  btree_multiset() = default;
+  explicit btree_multiset(const Compare &comp,
+                          const allocator_type &alloc = allocator_type())
+      : BT(comp, alloc) {}
+  explicit btree_multiset(const allocator_type &alloc) : BT(alloc) {}
+  btree_multiset(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+  btree_multiset(const btree_multiset &other) = default;
+  btree_multiset(btree_multiset &&other) noexcept = default;
+  ~btree_multiset() = default;
+
+  btree_multiset &operator=(btree_multiset &&other) noexcept = default;
+
+  iterator begin() const noexcept { return BT::begin(); }
+  iterator end() const noexcept { return BT::end(); }
+
+  iterator insert(const value_type &value) { return BT::insertMulti(value); }
+  template <class... Args>
+  iterator emplace(Args &&...args) {
+    return BT::insertMulti(value_type(std::forward<Args>(args)...));
+  }
+  void swap(btree_multiset &other) noexcept { BT::swapTree(other); }
+  // забирает все элементы other
+  void merge(btree_multiset &other) {
+    if (&other == this) return;
+    for (const auto &item : other) BT::insertMulti(item);
+    other.clear();
+  }
+
+  iterator find(const Key &key) const { return BT::find(key); }
+  iterator lower_bound(const Key &key) const { return BT::lower_bound(key); }
+  iterator upper_bound(const Key &key) const { return BT::upper_bound(key); }
+  pairiterator equal_range(const Key &key) const {
+    return BT::equal_range(key);
+  }
+};
+
+// ключи, которые уже есть в *this, остаются в other
+template <class Key, class Compare, class Allocator>
+void btree_set<Key, Compare, Allocator>::merge(btree_set &other) {
+  if (&other == this) return;
+  btree_set rest(other.key_comp(), other.get_allocator());
+  for (const auto &item : other)
+    if (!BT::insertUnique(item, item).second) rest.insert(item);
+  other.swap(rest);
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_SET_H
@@ -0,0 +1,200 @@
+#ifndef S21_CONCURRENT_MAP_H
+#define S21_CONCURRENT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "cache_line.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+// Отображение для многих потоков: ключи по хешу раскладываются на Shards
+// частей, каждая - s21::map под своим shared_mutex. Писатель блокирует
+// только свою часть, читатели разных частей друг другу не мешают.
+// Ключи, равные по Compare, должны давать равный Hash
+template <class K, class V, class Compare = std::less<K>,
+          class Hash = std::hash<K>, std::size_t Shards = 16U>
+class concurrent_map {
+  static_assert(Shards > 0U, "concurrent_map: Shards must be positive");
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using hasher = Hash;
+  using shard_type = map<K, V, Compare>;
+
+  concurrent_map() = default;
+  explicit concurrent_map(const Compare &comp, const Hash &hash = Hash());
+  concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map() = default;
+
+  static constexpr size_type shard_count() noexcept { return Shards; }
+  // части опрашиваются по очереди, поэтому при параллельных вставках
+  // результат приблизительный
+  [[nodiscard]] size_type size() const;
+  [[nodiscard]] bool empty() const { return size() == 0U; }
+
+  // true - ключа не было и пара вставлена, false - значение заменено
+  bool insert_or_assign(const K &key, const V &value);
+  size_type erase(const K &key);
+  void clear();
+
+  bool contains(const K &key) const;
+  // копия значения: ссылка на элемент пережила бы блокировку
+  std::optional<V> find(const K &key) const;
+  // вызывает fn(const V &) под блокировкой на чтение; false - ключа нет
+  template <class Fn>
+  bool visit(const K &key, Fn &&fn) const;
+  // Обход всех пар по возрастанию ключа. Все части блокируются на чтение
+  // на время обхода, поэтому fn видит согласованный снимок, а писатели
+  // ждут. fn не должен обращаться к этому же отображению
+  template <class Fn>
+  void for_each(Fn &&fn) const;
+
+ private:
+  // s21::map не даёт константного поиска, но find и contains дерево не
+  // меняют, поэтому под блокировкой на чтение их можно звать из разных
+  // потоков
+  struct alignas(kCacheLine) Shard {
+    mutable std::shared_mutex mutex;
+    mutable shard_type items;
+  };
+
+  Shard &shardFor(const K &key) const {
+    return shards_[hash_(key) % Shards];
+  }
+
+  mutable Shard shards_[Shards];
+  Compare compare_;
+  Hash hash_;
+};
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+concurrent_map<K, V, Compare, Hash, Shards>::concurrent_map(
+    const Compare &comp, const Hash &hash)
+    : compare_(comp), hash_(hash) {
+  for (Shard &shard : shards_) shard.items = shard_type(comp);
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+concurrent_map<K, V, Compare, Hash, Shards>::concurrent_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) shardFor(item.first).items.insert(item);
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+typename concurrent_map<K, V, Compare, Hash, Shards>::size_type
+concurrent_map<K, V, Compare, Hash, Shards>::size() const {
+  size_type total = 0U;
+  for (Shard &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    total += shard.items.size();
+  }
+  return total;
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+bool concurrent_map<K, V, Compare, Hash, Shards>::insert_or_assign(
+    const K &key, const V &value) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.items.insert_or_assign(key, value).second;
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+typename concurrent_map<K, V, Compare, Hash, Shards>::size_type
+concurrent_map<K, V, Compare, Hash, Shards>::erase(const K &key) {
+  Shard &shard = shardFor(key);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto pos = shard.items.find(key);
+  if (pos == shard.items.end()) return 0U;
+  shard.items.erase(pos);
+  return 1U;
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+void concurrent_map<K, V, Compare, Hash, Shards>::clear() {
+  for (Shard &shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.items = shard_type(compare_);
+  }
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+bool concurrent_map<K, V, Compare, Hash, Shards>::contains(
+    const K &key) const {
+  Shard &shard = shardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.items.contains(key);
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+std::optional<V> concurrent_map<K, V, Compare, Hash, Shards>::find(
+    const K &key) const {
+  std::optional<V> result;
+  visit(key, [&result](const V &value) { result.emplace(value); });
+  return result;
+}
+
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+template <class Fn>
+bool concurrent_map<K, V, Compare, Hash, Shards>::visit(const K &key,
+                                                        Fn &&fn) const {
+  Shard &shard = shardFor(key);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  auto pos = shard.items.find(key);
+  if (pos == shard.items.end()) return false;
+  const V &value = pos->second;
+  std::forward<Fn>(fn)(value);
+  return true;
+}
+
+// Части блокируются всегда в порядке номеров, а писатель держит только
+// одну часть, поэтому взаимной блокировки нет. Упорядоченные части
+// сливаются через кучу из текущих позиций
+template <class K, class V, class Compare, class Hash, std::size_t Shards>
+template <class Fn>
+void concurrent_map<K, V, Compare, Hash, Shards>::for_each(Fn &&fn) const {
+  using iterator = typename shard_type::iterator;
+  std::vector<std::shared_lock<std::shared_mutex>> locks;
+  locks.reserve(Shards);
+  std::vector<iterator> heads;
+  heads.reserve(Shards);
+  for (Shard &shard : shards_) {
+    locks.emplace_back(shard.mutex);
+    if (!shard.items.empty()) heads.push_back(shard.items.begin());
+  }
+  // куча с наименьшим ключом на вершине
+  auto later = [this](const iterator &a, const iterator &b) {
+    return compare_(b->first, a->first);
+  };
+  std::make_heap(heads.begin(), heads.end(), later);
+  while (!heads.empty()) {
+    std::pop_heap(heads.begin(), heads.end(), later);
+    iterator &pos = heads.back();
+    const value_type &item = *pos;
+    fn(item);
+    if (++pos == iterator()) {
+      heads.pop_back();
+    } else {
+      std::push_heap(heads.begin(), heads.end(), later);
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_MAP_H
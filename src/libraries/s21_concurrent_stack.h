@@ -0,0 +1,256 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Стек без блокировок (стек Трайбера) для многих потоков.
+// Узлы лежат в слябах и адресуются 32-битным номером; вершина - номер
+// вместе со счётчиком изменений в одном 64-битном слове. Счётчик растёт
+// на каждой операции, поэтому CAS не пройдёт, если узел успели снять и
+// вернуть обратно (ABA). Снятые узлы уходят в такой же список свободных и
+// переиспользуются, память слябов освобождается только в деструкторе:
+// поток, который ещё читает next снятого узла, всегда читает живую память
+template <class T, class Allocator = std::allocator<T>>
+class ConcurrentStack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  ConcurrentStack() = default;
+  explicit ConcurrentStack(const allocator_type &alloc) : alloc_(alloc) {}
+  ConcurrentStack(const ConcurrentStack &) = delete;
+  ConcurrentStack &operator=(const ConcurrentStack &) = delete;
+  ~ConcurrentStack();
+
+  // пока другие потоки работают со стеком, ответ может устареть
+  [[nodiscard]] bool empty() const noexcept {
+    return index(top_.load(std::memory_order_acquire)) == kNull;
+  }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <class... Args>
+  void emplace(Args &&...args);
+  // false - стек пуст
+  bool try_pop(reference out);
+  // одним CAS забирает всю цепочку и переносит элементы в out от вершины
+  // к основанию; возвращает их число
+  template <class OutputIt>
+  size_type pop_all(OutputIt out);
+
+ private:
+  using index_type = std::uint32_t;
+  using head_type = std::uint64_t;
+
+  struct Node {
+    std::atomic<index_type> next{kNull};
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    value_type *item() noexcept {
+      return reinterpret_cast<value_type *>(bytes);
+    }
+  };
+  using node_allocator = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  static constexpr index_type kNull = ~index_type{0};
+  // сляб k вмещает kFirstSlab << k узлов, всего до 2^32 - 64 узлов
+  static constexpr std::size_t kFirstSlab = 64U;
+  static constexpr std::size_t kSlabs = 26U;
+  static constexpr std::uint64_t kMaxNodes =
+      kFirstSlab * ((std::uint64_t{1} << kSlabs) - 1U);
+
+  static index_type index(head_type head) noexcept {
+    return static_cast<index_type>(head);
+  }
+  static head_type nextHead(head_type head, index_type top) noexcept {
+    return ((head >> 32U) + 1U) << 32U | top;
+  }
+  static std::size_t slabOf(std::uint64_t i) noexcept {
+    std::uint64_t blocks = i / kFirstSlab + 1U;
+    std::size_t slab = 0U;
+    while (blocks >>= 1U) ++slab;
+    return slab;
+  }
+  static std::size_t slabSize(std::size_t slab) noexcept {
+    return kFirstSlab << slab;
+  }
+  Node *node(index_type i) const noexcept {
+    std::size_t slab = slabOf(i);
+    std::size_t first = kFirstSlab * ((std::size_t{1} << slab) - 1U);
+    return slabs_[slab].load(std::memory_order_acquire) + (i - first);
+  }
+
+  // общие для стека и списка свободных операции над цепочкой
+  void pushChain(std::atomic<head_type> &head, index_type first,
+                 Node *last) noexcept;
+  index_type popOne(std::atomic<head_type> &head) noexcept;
+  index_type allocate();
+  void release(index_type i) noexcept {
+    pushChain(free_, i, node(i));
+  }
+
+  alignas(kCacheLine) std::atomic<head_type> top_{kNull};
+  alignas(kCacheLine) std::atomic<head_type> free_{kNull};
+  alignas(kCacheLine) std::atomic<std::uint64_t> fresh_{0U};
+  std::atomic<Node *> slabs_[kSlabs] = {};
+  node_allocator alloc_;
+};
+
+template <class T, class Allocator>
+ConcurrentStack<T, Allocator>::~ConcurrentStack() {
+  for (index_type i = index(top_.load(std::memory_order_acquire));
+       i != kNull; i = node(i)->next.load(std::memory_order_relaxed))
+    node(i)->item()->~T();
+  for (std::size_t slab = 0U; slab < kSlabs; ++slab) {
+    Node *nodes = slabs_[slab].load(std::memory_order_relaxed);
+    if (nodes == nullptr) continue;
+    for (std::size_t k = 0U; k < slabSize(slab); ++k)
+      node_traits::destroy(alloc_, nodes + k);
+    node_traits::deallocate(alloc_, nodes, slabSize(slab));
+  }
+}
+
+// first..last уже связаны через next; вершиной становится first
+template <class T, class Allocator>
+void ConcurrentStack<T, Allocator>::pushChain(std::atomic<head_type> &head,
+                                              index_type first,
+                                              Node *last) noexcept {
+  head_type old = head.load(std::memory_order_relaxed);
+  do {
+    last->next.store(index(old), std::memory_order_relaxed);
+  } while (!head.compare_exchange_weak(old, nextHead(old, first),
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+// next читается до CAS: узел могли уже снять и переиспользовать, тогда
+// счётчик в head изменился и CAS повторится
+template <class T, class Allocator>
+typename ConcurrentStack<T, Allocator>::index_type
+ConcurrentStack<T, Allocator>::popOne(std::atomic<head_type> &head) noexcept {
+  head_type old = head.load(std::memory_order_acquire);
+  for (;;) {
+    index_type top = index(old);
+    if (top == kNull) return kNull;
+    index_type next = node(top)->next.load(std::memory_order_relaxed);
+    if (head.compare_exchange_weak(old, nextHead(old, next),
+                                   std::memory_order_acquire,
+                                   std::memory_order_acquire))
+      return top;
+  }
+}
+
+// узел из списка свободных, иначе следующий ещё не тронутый; сляб под
+// него создаёт первый поток, которому он понадобился
+template <class T, class Allocator>
+typename ConcurrentStack<T, Allocator>::index_type
+ConcurrentStack<T, Allocator>::allocate() {
+  index_type reused = popOne(free_);
+  if (reused != kNull) return reused;
+  std::uint64_t i = fresh_.fetch_add(1U, std::memory_order_relaxed);
+  if (i >= kMaxNodes) throw std::length_error("ConcurrentStack");
+  std::size_t slab = slabOf(i);
+  if (slabs_[slab].load(std::memory_order_acquire) == nullptr) {
+    Node *nodes = node_traits::allocate(alloc_, slabSize(slab));
+    for (std::size_t k = 0U; k < slabSize(slab); ++k)
+      node_traits::construct(alloc_, nodes + k);
+    Node *expected = nullptr;
+    if (!slabs_[slab].compare_exchange_strong(expected, nodes,
+                                              std::memory_order_acq_rel)) {
+      for (std::size_t k = 0U; k < slabSize(slab); ++k)
+        node_traits::destroy(alloc_, nodes + k);
+      node_traits::deallocate(alloc_, nodes, slabSize(slab));
+    }
+  }
+  return static_cast<index_type>(i);
+}
+
+template <class T, class Allocator>
+template <class... Args>
+void ConcurrentStack<T, Allocator>::emplace(Args &&...args) {
+  index_type i = allocate();
+  Node *target = node(i);
+  try {
+    ::new (static_cast<void *>(target->item()))
+        T(std::forward<Args>(args)...);
+  } catch (...) {
+    release(i);
+    throw;
+  }
+  pushChain(top_, i, target);
+}
+
+template <class T, class Allocator>
+bool ConcurrentStack<T, Allocator>::try_pop(reference out) {
+  index_type i = popOne(top_);
+  if (i == kNull) return false;
+  // узел возвращается в пул, даже если присваивание бросит
+  struct Release {
+    ConcurrentStack *stack;
+    index_type i;
+    ~Release() {
+      stack->node(i)->item()->~T();
+      stack->release(i);
+    }
+  } guard{this, i};
+  out = std::move(*node(i)->item());
+  return true;
+}
+
+// цепочка после exchange принадлежит только этому потоку; её узлы
+// возвращаются в список свободных одним CAS
+template <class T, class Allocator>
+template <class OutputIt>
+typename ConcurrentStack<T, Allocator>::size_type
+ConcurrentStack<T, Allocator>::pop_all(OutputIt out) {
+  head_type old = top_.load(std::memory_order_relaxed);
+  while (!top_.compare_exchange_weak(old, nextHead(old, kNull),
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+  }
+  index_type first = index(old);
+  if (first == kNull) return 0U;
+  size_type count = 0U;
+  Node *last = nullptr;
+  try {
+    for (index_type i = first; i != kNull;
+         i = last->next.load(std::memory_order_relaxed)) {
+      last = node(i);
+      *out = std::move(*last->item());
+      ++out;
+      last->item()->~T();
+      ++count;
+    }
+  } catch (...) {
+    // непереданные элементы разрушаются вместе с узлами
+    for (index_type i = last->next.load(std::memory_order_relaxed);
+         i != kNull; i = node(i)->next.load(std::memory_order_relaxed)) {
+      last->item()->~T();
+      last = node(i);
+    }
+    last->item()->~T();
+    pushChain(free_, first, last);
+    throw;
+  }
+  pushChain(free_, first, last);
+  return count;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_STACK_H
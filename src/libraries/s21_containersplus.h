@@ -2,6 +2,18 @@
 #define CPP2_S21_CONTAINERS_LIBRARIES_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_stack.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_mpmc_queue.h"
 #include "s21_multiset.h"
+#include "s21_snapshot_map.h"
+#include "s21_spsc_queue.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_multiset.h"
+#include "s21_unordered_set.h"
 
-#endif  // CPP2_S21_CONTAINERS_LIBRARIES_S21_CONTAINERSPLUS_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_LIBRARIES_S21_CONTAINERSPLUS_H_
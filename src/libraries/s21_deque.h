@@ -1,139 +1,281 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
 #include "s21_containers.h"
 
 namespace s21 {
 
-template <class T>
+// Сегментированный дек: элементы лежат в блоках фиксированного размера,
+// указатели на блоки хранятся в карте blocks. Индекс элемента i в деке
+// соответствует позиции start + i в "виртуальном" массиве блоков.
+template <class T, class Allocator = std::allocator<T>>
 class Deque {
  public:
+  using allocator_type = Allocator;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
 
-  struct node {
-    value_type val;
-    node *next;
-    node *prev;
-    node() : val(), next(nullptr), prev(nullptr){};
-    node(value_type value) : val(value), next(nullptr), prev(nullptr){};
-  };
+  template <bool IsConst>
+  class DequeIterator;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  using map_allocator = typename alloc_traits::template rebind_alloc<T *>;
+  using map_traits = std::allocator_traits<map_allocator>;
+
+  // размер блока - степень двойки около 4 КиБ, чтобы индекс считался сдвигом
+  static constexpr size_type blockSizeFor(size_type bytes) {
+    size_type count = 16U;
+    while (count * 2U * sizeof(value_type) <= bytes) count *= 2U;
+    return count;
+  }
+  static constexpr size_type kBlockSize = blockSizeFor(4096U);
+  static constexpr size_type kMinMapSize = 8U;
 
  public:
   // constructors
-  Deque() : head(nullptr), tail(nullptr), deqSize(0U){};
+  Deque() = default;
+  explicit Deque(const allocator_type &alloc) : alloc_(alloc){};
   Deque(std::initializer_list<value_type> const &items) : Deque() {
     for (auto it = items.begin(); it != items.end(); it++) {
       push_back(*it);
     }
   }
-  Deque(const Deque &other) : Deque() {
+  Deque(const Deque &other)
+      : Deque(alloc_traits::select_on_container_copy_construction(
+            other.alloc_)) {
     for (size_type i = 0; i < other.size(); ++i) {
-      push_back(other[i]->val);
+      push_back(other[i]);
     }
   }
-  Deque(Deque &&other) noexcept : Deque() {
-    swap(other);
-    other.~Deque();
-  }
+  Deque(Deque &&other) noexcept : Deque() { swap(other); }
   ~Deque() {
-    deqSize = 0U;
-    node *current = head;
-    while (current) {
-      node *next = current->next;
-      delete current;
-      current = next;
+    clear();
+    if (blocks) {
+      map_allocator map_alloc(alloc_);
+      map_traits::deallocate(map_alloc, blocks, blocksCount);
     }
   }
 
   Deque &operator=(Deque &&other) {
     swap(other);
-    other.~Deque();
     return *this;
   }
 
-  const_reference front() const { return head->val; }
-  const_reference back() const { return tail->val; }
+  allocator_type get_allocator() const { return alloc_; }
+
+  const_reference front() const { return (*this)[0]; }
+  const_reference back() const { return (*this)[deqSize - 1]; }
 
-  bool empty() const noexcept { return head == nullptr; }
+  bool empty() const noexcept { return deqSize == 0U; }
   size_type size() const noexcept { return deqSize; }
 
-  node *operator[](const size_type index) const {
-    if (!head) return nullptr;
-    node *p = head;
-    for (size_type i = 0; i < index; i++) {
-      p = p->next;
-      if (!p) return nullptr;
-    }
-    return p;
+  reference operator[](const size_type index) {
+    size_type pos = start + index;
+    return blocks[pos / kBlockSize][pos % kBlockSize];
   }
-
-  void push_back(const_reference val) {
-    std::unique_ptr<node> buff(new node(val));
-    if (empty()) {
-      head = tail = buff.get();
-    } else {
-      buff->prev = tail;
-      tail->next = buff.get();
-      tail = buff.get();
-    }
-    buff.release();
-    deqSize++;
+  const_reference operator[](const size_type index) const {
+    size_type pos = start + index;
+    return blocks[pos / kBlockSize][pos % kBlockSize];
   }
-
-  void push_front(value_type val) {
-    std::unique_ptr<node> buff(new node(std::move(val)));
-    buff->next = head;
-    buff->prev = nullptr;
-    if (empty()) {
-      head = tail = buff.get();
-    } else {
-      head->prev = buff.get();
-      head = buff.get();
-    }
-    buff.release();
-    deqSize++;
+  reference at(const size_type index) {
+    if (index >= deqSize) throw std::out_of_range("Deque::at");
+    return (*this)[index];
   }
 
+  iterator begin() noexcept { return iterator(this, 0U); }
+  iterator end() noexcept { return iterator(this, deqSize); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0U); }
+  const_iterator end() const noexcept { return const_iterator(this, deqSize); }
+
+  void push_back(const_reference val) { emplace_back(val); }
+  void push_back(value_type &&val) { emplace_back(std::move(val)); }
+  void push_front(const_reference val) { emplace_front(val); }
+  void push_front(value_type &&val) { emplace_front(std::move(val)); }
+
   void pop_back() {
     if (empty()) return;
-    std::unique_ptr<node> buff(tail);
-    if (tail->prev == nullptr) {
-      tail = head = nullptr;
-    } else {
-      tail->prev->next = nullptr;
-      tail = tail->prev;
-    }
+    size_type pos = start + deqSize - 1U;
+    alloc_traits::destroy(alloc_, &blocks[pos / kBlockSize][pos % kBlockSize]);
     deqSize--;
+    if (deqSize == 0U || pos % kBlockSize == 0U) releaseBlock(pos / kBlockSize);
   }
 
   void pop_front() {
     if (empty()) return;
-    std::unique_ptr<node> buff(head);
-    if (head->next == nullptr) {
-      tail = head = nullptr;
-    } else {
-      head->next->prev = nullptr;
-      head = head->next;
-    }
+    size_type pos = start;
+    alloc_traits::destroy(alloc_, &blocks[pos / kBlockSize][pos % kBlockSize]);
+    start++;
     deqSize--;
+    if (deqSize == 0U || start % kBlockSize == 0U)
+      releaseBlock(pos / kBlockSize);
+  }
+
+  void clear() noexcept {
+    while (!empty()) pop_back();
   }
 
-  void swap(Deque &other) {
-    std::swap(other.head, head);
-    std::swap(other.tail, tail);
+  void swap(Deque &other) noexcept {
+    std::swap(other.blocks, blocks);
+    std::swap(other.blocksCount, blocksCount);
+    std::swap(other.start, start);
     std::swap(other.deqSize, deqSize);
+    std::swap(other.alloc_, alloc_);
   }
 
   template <class... Args>
   void emplace_back(Args &&...args) {
-    value_type temp_(std::forward<Args>(args)...);
-    push_back(temp_);
+    if (start + deqSize == blocksCount * kBlockSize) growMap();
+    size_type pos = start + deqSize;
+    constructAt(pos, std::forward<Args>(args)...);
+    deqSize++;
+  }
+
+  template <class... Args>
+  void emplace_front(Args &&...args) {
+    if (start == 0U) growMap();
+    size_type pos = start - 1U;
+    constructAt(pos, std::forward<Args>(args)...);
+    start = pos;
+    deqSize++;
   }
 
  private:
-  node *head;
-  node *tail;
+  template <class... Args>
+  void constructAt(size_type pos, Args &&...args) {
+    T *&block = blocks[pos / kBlockSize];
+    bool fresh = block == nullptr;
+    if (fresh) block = alloc_traits::allocate(alloc_, kBlockSize);
+    try {
+      alloc_traits::construct(alloc_, block + pos % kBlockSize,
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) releaseBlock(pos / kBlockSize);
+      throw;
+    }
+  }
+
+  void releaseBlock(size_type index) {
+    alloc_traits::deallocate(alloc_, blocks[index], kBlockSize);
+    blocks[index] = nullptr;
+  }
+
+  // освобождает место в карте блоков с обеих сторон: сначала пробует
+  // отцентровать занятые блоки, и только если карта заполнена - растит её
+  void growMap() {
+    size_type first = start / kBlockSize;
+    size_type used = deqSize ? (start + deqSize - 1U) / kBlockSize - first + 1U
+                             : 0U;
+    size_type needed = used + 1U;
+    T **target = blocks;
+    size_type targetCount = blocksCount;
+    if (blocksCount < 2U * needed) {
+      targetCount = std::max({kMinMapSize, 2U * blocksCount, 2U * needed});
+      map_allocator map_alloc(alloc_);
+      target = map_traits::allocate(map_alloc, targetCount);
+      std::fill(target, target + targetCount, nullptr);
+    }
+    size_type newFirst = (targetCount - used) / 2U;
+    if (target == blocks) {
+      if (newFirst < first) {
+        std::copy(blocks + first, blocks + first + used, blocks + newFirst);
+        std::fill(blocks + std::max(newFirst + used, first),
+                  blocks + first + used, nullptr);
+      } else if (newFirst > first) {
+        std::copy_backward(blocks + first, blocks + first + used,
+                           blocks + newFirst + used);
+        std::fill(blocks + first, blocks + std::min(first + used, newFirst),
+                  nullptr);
+      }
+    } else {
+      if (used)
+        std::copy(blocks + first, blocks + first + used, target + newFirst);
+      if (blocks) {
+        map_allocator map_alloc(alloc_);
+        map_traits::deallocate(map_alloc, blocks, blocksCount);
+      }
+      blocks = target;
+      blocksCount = targetCount;
+    }
+    start = newFirst * kBlockSize + start % kBlockSize;
+  }
 
-  size_type deqSize;
+  T **blocks{};
+  size_type blocksCount{};
+  size_type start{};
+  size_type deqSize{};
+  allocator_type alloc_;
+};
+
+template <class T, class Allocator>
+template <bool IsConst>
+class Deque<T, Allocator>::DequeIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+  using owner = std::conditional_t<IsConst, const Deque, Deque>;
+
+  DequeIterator() = default;
+  DequeIterator(owner *deque, size_type index) : deq(deque), pos(index) {}
+  operator DequeIterator<true>() const { return {deq, pos}; }
+
+  reference operator*() const { return (*deq)[pos]; }
+  pointer operator->() const { return &(*deq)[pos]; }
+  reference operator[](difference_type n) const { return (*deq)[pos + n]; }
+
+  DequeIterator &operator++() {
+    ++pos;
+    return *this;
+  }
+  DequeIterator operator++(int) {
+    DequeIterator tmp = *this;
+    ++pos;
+    return tmp;
+  }
+  DequeIterator &operator--() {
+    --pos;
+    return *this;
+  }
+  DequeIterator operator--(int) {
+    DequeIterator tmp = *this;
+    --pos;
+    return tmp;
+  }
+  DequeIterator &operator+=(difference_type n) {
+    pos += n;
+    return *this;
+  }
+  DequeIterator &operator-=(difference_type n) {
+    pos -= n;
+    return *this;
+  }
+  DequeIterator operator+(difference_type n) const {
+    return DequeIterator(deq, pos + n);
+  }
+  DequeIterator operator-(difference_type n) const {
+    return DequeIterator(deq, pos - n);
+  }
+  difference_type operator-(const DequeIterator &other) const {
+    return static_cast<difference_type>(pos) -
+           static_cast<difference_type>(other.pos);
+  }
+
+  bool operator==(const DequeIterator &other) const { return pos == other.pos; }
+  bool operator!=(const DequeIterator &other) const { return pos != other.pos; }
+  bool operator<(const DequeIterator &other) const { return pos < other.pos; }
+
+ private:
+  owner *deq{};
+  size_type pos{};
 };
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,379 @@
+#ifndef S21_FLAT_MAP_H
+#define S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Ассоциативный массив на отсортированных непрерывных массивах: ключи и
+// значения лежат в двух Vector с общими индексами, поиск - бинарный по
+// плотному массиву ключей. Вставка и удаление сдвигают хвост, поэтому
+// контейнер рассчитан на таблицы, которые строятся один раз и часто читаются.
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class flat_map {
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const K, T>;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <bool IsConst>
+  class FlatIterator;
+  using iterator = FlatIterator<false>;
+  using const_iterator = FlatIterator<true>;
+  using insert_result = std::pair<iterator, bool>;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  using key_container =
+      Vector<K, typename alloc_traits::template rebind_alloc<K>>;
+  using mapped_container =
+      Vector<T, typename alloc_traits::template rebind_alloc<T>>;
+
+ public:
+  flat_map() = default;
+  explicit flat_map(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : keys_(keyAlloc(alloc)), values_(mappedAlloc(alloc)), comp_(comp) {}
+  explicit flat_map(const allocator_type &alloc)
+      : keys_(keyAlloc(alloc)), values_(mappedAlloc(alloc)) {}
+  // сортирует вход один раз; из повторяющихся ключей остаётся первый
+  template <class InputIt,
+            class = typename std::iterator_traits<InputIt>::iterator_category>
+  flat_map(InputIt first, InputIt last, const Compare &comp = Compare(),
+           const allocator_type &alloc = allocator_type());
+  flat_map(std::initializer_list<value_type> const &items)
+      : flat_map(items.begin(), items.end()) {}
+  flat_map(const flat_map &other) = default;
+  flat_map(flat_map &&other) = default;
+  ~flat_map() = default;
+
+  flat_map &operator=(flat_map &&other) = default;
+
+  allocator_type get_allocator() const {
+    return allocator_type(keys_.get_allocator());
+  }
+  key_compare key_comp() const { return comp_; }
+
+  iterator begin() noexcept { return iterator(keys_.begin(), values_.begin()); }
+  iterator end() noexcept { return iterator(keys_.end(), values_.end()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(keys_.begin(), values_.begin());
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(keys_.end(), values_.end());
+  }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (sizeof(K) + sizeof(T)) /
+           2U;
+  }
+
+  T &at(const K &key);
+  const T &at(const K &key) const;
+  T &operator[](const K &key);
+
+  void clear() noexcept;
+  insert_result insert(const value_type &value);
+  insert_result insert(const K &key, const T &value);
+  insert_result insert_or_assign(const K &key, const T &value);
+  iterator erase(iterator pos);
+  size_type erase(const K &key);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+
+  iterator find(const K &key);
+  const_iterator find(const K &key) const;
+  bool contains(const K &key) const { return findIndex(key) != size(); }
+  iterator lower_bound(const K &key) { return iteratorAt(lowerIndex(key)); }
+  iterator upper_bound(const K &key);
+
+ private:
+  static typename key_container::allocator_type keyAlloc(
+      const allocator_type &alloc) {
+    return typename key_container::allocator_type(alloc);
+  }
+  static typename mapped_container::allocator_type mappedAlloc(
+      const allocator_type &alloc) {
+    return typename mapped_container::allocator_type(alloc);
+  }
+  iterator iteratorAt(size_type i) {
+    return iterator(keys_.begin() + i, values_.begin() + i);
+  }
+  size_type lowerIndex(const K &key) const {
+    return std::lower_bound(keys_.begin(), keys_.end(), key, comp_) -
+           keys_.begin();
+  }
+  // индекс ключа или size(), если ключа нет
+  size_type findIndex(const K &key) const {
+    size_type i = lowerIndex(key);
+    return i != size() && !comp_(key, keys_[i]) ? i : size();
+  }
+  insert_result insertAt(size_type i, const K &key, const T &value);
+
+  key_container keys_;
+  mapped_container values_;
+  Compare comp_;
+};
+
+// итератор ссылается на пару элементов с одинаковым индексом; разыменование
+// возвращает пару ссылок, а operator-> - прокси с такой парой внутри
+template <class K, class T, class Compare, class Allocator>
+template <bool IsConst>
+class flat_map<K, T, Compare, Allocator>::FlatIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<const K, T>;
+  using difference_type = std::ptrdiff_t;
+  using mapped_pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference =
+      std::pair<const K &, std::conditional_t<IsConst, const T &, T &>>;
+  struct pointer {
+    reference ref;
+    reference *operator->() { return &ref; }
+  };
+
+  FlatIterator() = default;
+  FlatIterator(const K *key, mapped_pointer value) : key_(key), value_(value) {}
+  operator FlatIterator<true>() const { return {key_, value_}; }
+
+  reference operator*() const { return reference(*key_, *value_); }
+  pointer operator->() const { return pointer{**this}; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  FlatIterator &operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+  FlatIterator operator++(int) {
+    FlatIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  FlatIterator &operator--() {
+    --key_;
+    --value_;
+    return *this;
+  }
+  FlatIterator operator--(int) {
+    FlatIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+  FlatIterator &operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+  FlatIterator &operator-=(difference_type n) { return *this += -n; }
+  FlatIterator operator+(difference_type n) const {
+    return FlatIterator(key_ + n, value_ + n);
+  }
+  FlatIterator operator-(difference_type n) const {
+    return FlatIterator(key_ - n, value_ - n);
+  }
+  difference_type operator-(const FlatIterator &other) const {
+    return key_ - other.key_;
+  }
+
+  bool operator==(const FlatIterator &other) const {
+    return key_ == other.key_;
+  }
+  bool operator!=(const FlatIterator &other) const {
+    return key_ != other.key_;
+  }
+  bool operator<(const FlatIterator &other) const { return key_ < other.key_; }
+
+ private:
+  friend class flat_map;
+  const K *key_{};
+  mapped_pointer value_{};
+};
+
+template <class K, class T, class Compare, class Allocator>
+template <class InputIt, class>
+flat_map<K, T, Compare, Allocator>::flat_map(InputIt first, InputIt last,
+                                             const Compare &comp,
+                                             const allocator_type &alloc)
+    : keys_(keyAlloc(alloc)), values_(mappedAlloc(alloc)), comp_(comp) {
+  using item_allocator =
+      typename alloc_traits::template rebind_alloc<std::pair<K, T>>;
+  item_allocator item_alloc(alloc);
+  Vector<std::pair<K, T>, item_allocator> items(item_alloc);
+  for (; first != last; ++first) items.push_back(*first);
+  auto less = [this](const std::pair<K, T> &a, const std::pair<K, T> &b) {
+    return comp_(a.first, b.first);
+  };
+  if (!std::is_sorted(items.begin(), items.end(), less))
+    std::stable_sort(items.begin(), items.end(), less);
+  keys_.reserve(items.size());
+  values_.reserve(items.size());
+  for (auto &item : items) {
+    if (keys_.empty() || comp_(keys_[keys_.size() - 1U], item.first)) {
+      keys_.push_back(std::move(item.first));
+      values_.push_back(std::move(item.second));
+    }
+  }
+}
+
+template <class K, class T, class Compare, class Allocator>
+T &flat_map<K, T, Compare, Allocator>::at(const K &key) {
+  size_type i = findIndex(key);
+  if (i == size()) throw std::out_of_range("flat_map::at");
+  return values_[i];
+}
+template <class K, class T, class Compare, class Allocator>
+const T &flat_map<K, T, Compare, Allocator>::at(const K &key) const {
+  size_type i = findIndex(key);
+  if (i == size()) throw std::out_of_range("flat_map::at");
+  return values_[i];
+}
+template <class K, class T, class Compare, class Allocator>
+T &flat_map<K, T, Compare, Allocator>::operator[](const K &key) {
+  size_type i = lowerIndex(key);
+  if (i == size() || comp_(key, keys_[i])) insertAt(i, key, T{});
+  return values_[i];
+}
+
+template <class K, class T, class Compare, class Allocator>
+void flat_map<K, T, Compare, Allocator>::clear() noexcept {
+  keys_.clear();
+  values_.clear();
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::insert_result
+flat_map<K, T, Compare, Allocator>::insert(const value_type &value) {
+  return insert(value.first, value.second);
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::insert_result
+flat_map<K, T, Compare, Allocator>::insert(const K &key, const T &value) {
+  size_type i = lowerIndex(key);
+  if (i != size() && !comp_(key, keys_[i])) return {iteratorAt(i), false};
+  return insertAt(i, key, value);
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::insert_result
+flat_map<K, T, Compare, Allocator>::insert_or_assign(const K &key,
+                                                     const T &value) {
+  size_type i = lowerIndex(key);
+  if (i != size() && !comp_(key, keys_[i])) {
+    values_[i] = value;
+    return {iteratorAt(i), false};
+  }
+  return insertAt(i, key, value);
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::insert_result
+flat_map<K, T, Compare, Allocator>::insertAt(size_type i, const K &key,
+                                             const T &value) {
+  keys_.insert(keys_.begin() + i, key);
+  try {
+    values_.insert(values_.begin() + i, value);
+  } catch (...) {
+    keys_.erase(keys_.begin() + i);
+    throw;
+  }
+  return {iteratorAt(i), true};
+}
+
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::iterator
+flat_map<K, T, Compare, Allocator>::erase(iterator pos) {
+  size_type i = pos.key_ - keys_.begin();
+  keys_.erase(keys_.begin() + i);
+  values_.erase(values_.begin() + i);
+  return iteratorAt(i);
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::size_type
+flat_map<K, T, Compare, Allocator>::erase(const K &key) {
+  size_type i = findIndex(key);
+  if (i == size()) return 0U;
+  erase(iteratorAt(i));
+  return 1U;
+}
+template <class K, class T, class Compare, class Allocator>
+void flat_map<K, T, Compare, Allocator>::swap(flat_map &other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+
+// слияние двух отсортированных последовательностей за O(n + m); ключи,
+// которые уже есть в *this, остаются в other
+template <class K, class T, class Compare, class Allocator>
+void flat_map<K, T, Compare, Allocator>::merge(flat_map &other) {
+  if (&other == this || other.empty()) return;
+  key_container keys(keys_.get_allocator()), rest_keys(keys_.get_allocator());
+  mapped_container values(values_.get_allocator()),
+      rest_values(values_.get_allocator());
+  // вся память выделяется до первого переноса: дальше push_back не
+  // выделяет, и исключение не оставит оба контейнера с пустыми элементами
+  keys.reserve(size() + other.size());
+  values.reserve(size() + other.size());
+  rest_keys.reserve(other.size());
+  rest_values.reserve(other.size());
+  size_type i = 0, j = 0;
+  auto take = [](key_container &from_keys, mapped_container &from_values,
+                 size_type &index, key_container &to_keys,
+                 mapped_container &to_values) {
+    to_keys.push_back(std::move(from_keys[index]));
+    to_values.push_back(std::move(from_values[index]));
+    ++index;
+  };
+  while (i < size() && j < other.size()) {
+    if (comp_(keys_[i], other.keys_[j])) {
+      take(keys_, values_, i, keys, values);
+    } else if (comp_(other.keys_[j], keys_[i])) {
+      take(other.keys_, other.values_, j, keys, values);
+    } else {
+      take(keys_, values_, i, keys, values);
+      take(other.keys_, other.values_, j, rest_keys, rest_values);
+    }
+  }
+  while (i < size()) take(keys_, values_, i, keys, values);
+  while (j < other.size()) take(other.keys_, other.values_, j, keys, values);
+  keys_.swap(keys);
+  values_.swap(values);
+  other.keys_.swap(rest_keys);
+  other.values_.swap(rest_values);
+}
+
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::iterator
+flat_map<K, T, Compare, Allocator>::find(const K &key) {
+  return iteratorAt(findIndex(key));
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::const_iterator
+flat_map<K, T, Compare, Allocator>::find(const K &key) const {
+  size_type i = findIndex(key);
+  return const_iterator(keys_.begin() + i, values_.begin() + i);
+}
+template <class K, class T, class Compare, class Allocator>
+typename flat_map<K, T, Compare, Allocator>::iterator
+flat_map<K, T, Compare, Allocator>::upper_bound(const K &key) {
+  return iteratorAt(std::upper_bound(keys_.begin(), keys_.end(), key, comp_) -
+                  keys_.begin());
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MAP_H
@@ -0,0 +1,164 @@
+#ifndef S21_FLAT_SET_H
+#define S21_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Множество на отсортированном Vector: ключи лежат подряд, поиск - бинарный
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  // ключи менять нельзя: это сломало бы порядок
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+  using insert_result = std::pair<iterator, bool>;
+
+ private:
+  using key_container = Vector<Key, Allocator>;
+
+ public:
+  flat_set() = default;
+  explicit flat_set(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : keys_(alloc), comp_(comp) {}
+  explicit flat_set(const allocator_type &alloc) : keys_(alloc) {}
+  // сортирует вход один раз и убирает повторы
+  template <class InputIt,
+            class = typename std::iterator_traits<InputIt>::iterator_category>
+  flat_set(InputIt first, InputIt last, const Compare &comp = Compare(),
+           const allocator_type &alloc = allocator_type());
+  flat_set(std::initializer_list<value_type> const &items)
+      : flat_set(items.begin(), items.end()) {}
+  flat_set(const flat_set &other) = default;
+  flat_set(flat_set &&other) = default;
+  ~flat_set() = default;
+
+  flat_set &operator=(flat_set &&other) = default;
+
+  allocator_type get_allocator() const { return keys_.get_allocator(); }
+  key_compare key_comp() const { return comp_; }
+
+  iterator begin() const noexcept { return keys_.begin(); }
+  iterator end() const noexcept { return keys_.end(); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Key) / 2U;
+  }
+
+  void clear() noexcept { keys_.clear(); }
+  insert_result insert(const value_type &value);
+  iterator erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(flat_set &other);
+  void merge(flat_set &other);
+
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const { return find(key) != end(); }
+  iterator lower_bound(const Key &key) const {
+    return std::lower_bound(begin(), end(), key, comp_);
+  }
+  iterator upper_bound(const Key &key) const {
+    return std::upper_bound(begin(), end(), key, comp_);
+  }
+
+ private:
+  // изменяемый итератор Vector на ту же позицию
+  typename key_container::iterator mutableAt(iterator pos) {
+    return keys_.begin() + (pos - begin());
+  }
+
+  key_container keys_;
+  Compare comp_;
+};
+
+template <class Key, class Compare, class Allocator>
+template <class InputIt, class>
+flat_set<Key, Compare, Allocator>::flat_set(InputIt first, InputIt last,
+                                            const Compare &comp,
+                                            const allocator_type &alloc)
+    : keys_(alloc), comp_(comp) {
+  for (; first != last; ++first) keys_.push_back(*first);
+  if (!std::is_sorted(keys_.begin(), keys_.end(), comp_))
+    std::stable_sort(keys_.begin(), keys_.end(), comp_);
+  auto equal = [this](const Key &a, const Key &b) { return !comp_(a, b); };
+  keys_.erase(std::unique(keys_.begin(), keys_.end(), equal), keys_.end());
+}
+
+template <class Key, class Compare, class Allocator>
+typename flat_set<Key, Compare, Allocator>::insert_result
+flat_set<Key, Compare, Allocator>::insert(const value_type &value) {
+  iterator pos = lower_bound(value);
+  if (pos != end() && !comp_(value, *pos)) return {pos, false};
+  return {keys_.insert(mutableAt(pos), value), true};
+}
+template <class Key, class Compare, class Allocator>
+typename flat_set<Key, Compare, Allocator>::iterator
+flat_set<Key, Compare, Allocator>::erase(iterator pos) {
+  return keys_.erase(mutableAt(pos));
+}
+template <class Key, class Compare, class Allocator>
+typename flat_set<Key, Compare, Allocator>::size_type
+flat_set<Key, Compare, Allocator>::erase(const Key &key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0U;
+  erase(pos);
+  return 1U;
+}
+template <class Key, class Compare, class Allocator>
+void flat_set<Key, Compare, Allocator>::swap(flat_set &other) {
+  keys_.swap(other.keys_);
+  std::swap(comp_, other.comp_);
+}
+
+// слияние за O(n + m); ключи, которые уже есть в *this, остаются в other
+template <class Key, class Compare, class Allocator>
+void flat_set<Key, Compare, Allocator>::merge(flat_set &other) {
+  if (&other == this || other.empty()) return;
+  key_container keys(keys_.get_allocator()), rest(keys_.get_allocator());
+  // память выделяется до первого переноса, дальше push_back не выделяет
+  keys.reserve(size() + other.size());
+  rest.reserve(other.size());
+  auto mine = keys_.begin(), theirs = other.keys_.begin();
+  while (mine != keys_.end() && theirs != other.keys_.end()) {
+    if (comp_(*mine, *theirs)) {
+      keys.push_back(std::move(*mine++));
+    } else if (comp_(*theirs, *mine)) {
+      keys.push_back(std::move(*theirs++));
+    } else {
+      keys.push_back(std::move(*mine++));
+      rest.push_back(std::move(*theirs++));
+    }
+  }
+  for (; mine != keys_.end(); ++mine) keys.push_back(std::move(*mine));
+  for (; theirs != other.keys_.end(); ++theirs)
+    keys.push_back(std::move(*theirs));
+  keys_.swap(keys);
+  other.keys_.swap(rest);
+}
+
+template <class Key, class Compare, class Allocator>
+typename flat_set<Key, Compare, Allocator>::iterator
+flat_set<Key, Compare, Allocator>::find(const Key &key) const {
+  iterator pos = lower_bound(key);
+  return pos != end() && !comp_(key, *pos) ? pos : end();
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H
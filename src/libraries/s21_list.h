@@ -1,11 +1,16 @@
 #ifndef CPP2_S21_CONTAINERS_LIBRARIES_S21_LIST_H_
 #define CPP2_S21_CONTAINERS_LIBRARIES_S21_LIST_H_
 
+#include <limits>
+#include <memory>
+#include <utility>
+
 namespace s21 {
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 
 class List {
  public:
+  using allocator_type = Allocator;
   using value_type = T;
   using pointer = T *;
   using reference = T &;
@@ -18,8 +23,10 @@ class List {
     ListNode *prev_;
     ListNode *next_;
     ListNode() : value_(), prev_(nullptr), next_(nullptr) {}
-    ListNode(const value_type value)
-        : value_(value), prev_(nullptr), next_(nullptr) {}
+    // значение строится прямо в узле из аргументов конструктора T
+    template <class... Args>
+    explicit ListNode(std::in_place_t, Args &&...args)
+        : value_(std::forward<Args>(args)...), prev_(nullptr), next_(nullptr) {}
   };
 
   class ListIterator {
@@ -53,11 +60,11 @@ class List {
       return *this;
     }
 
-    bool operator==(const ListIterator &other) {
+    bool operator==(const ListIterator &other) const {
       return current_ == other.current_;
     }
 
-    bool operator!=(const ListIterator &other) {
+    bool operator!=(const ListIterator &other) const {
       return current_ != other.current_;
     }
 
@@ -86,8 +93,15 @@ class List {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
 
+ private:
+  using node_allocator = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<ListNode>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+ public:
   // Constructors and destructor
   List() { initList(); }
+  explicit List(const allocator_type &alloc) : alloc_(alloc) { initList(); }
 
   List(size_type n) {
     initList();
@@ -103,36 +117,45 @@ class List {
     }
   }
 
-  List(const List &l) {
+  List(const List &l)
+      : alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
     initList();
     for (auto it = l.cbegin(); it != l.cend(); ++it) {
       push_back(*it);
     }
   }
 
-  List(List &&l) {
+  // узлы забираются целиком, l остаётся пустым
+  List(List &&l) noexcept : alloc_(l.alloc_) {
     initList();
-    for (auto i : l) {
-      push_back(i);
-    }
-    l.clear();
+    swap(l);
   }
 
   ~List() {
     while (head_) {
       ListNode *next = head_;
       head_ = head_->next_;
-      delete next;
+      destroyNode(next);
     }
     initList();
   }
 
   // Operators
-  List &operator=(List &&l) {
-    initList();
-    for (auto &i : l) {
-      push_back(i);
-    }
+  // прежние узлы уходят в l и освобождаются вместе с ним
+  List &operator=(List &&l) noexcept {
+    swap(l);
+    return *this;
+  }
+
+  // значения переписываются в уже выделенные узлы; новые узлы нужны,
+  // только если l длиннее
+  List &operator=(const List &l) {
+    if (this == &l) return *this;
+    ListNode *from = l.head_;
+    for (ListNode *to = head_; to && from; to = to->next_, from = from->next_)
+      to->value_ = from->value_;
+    for (; from; from = from->next_) push_back(from->value_);
+    while (m_size_ > l.m_size_) pop_back();
     return *this;
   }
 
@@ -142,6 +165,8 @@ class List {
     m_size_ = 0;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   // List Element
   const_reference front() { return head_->value_; }
   const_reference back() { return tail_->value_; }
@@ -151,10 +176,11 @@ class List {
   // // List Iterators
   const_iterator cbegin() const { return const_iterator(head_); }
 
-  const_iterator cend() const { return const_iterator(tail_->next_); }
+  // за хвостом всегда nullptr, поэтому end() есть и у пустого списка
+  const_iterator cend() const { return const_iterator(iterator(nullptr)); }
 
   iterator begin() { return iterator(head_); }
-  iterator end() { return iterator(tail_->next_); }
+  iterator end() { return iterator(nullptr); }
 
   // List Capacity
   bool empty() { return m_size_ == 0 ? true : false; }
@@ -163,25 +189,16 @@ class List {
     return std::numeric_limits<size_type>::max() / sizeof(size_type);
   }
 
-  void push_back(const_reference value) {
-    std::unique_ptr<ListNode> newTail(new ListNode(value));
-    if (tail_) {
-      newTail->prev_ = tail_;
-      tail_->next_ = newTail.get();
-      tail_ = newTail.get();
-    } else {
-      tail_ = head_ = newTail.get();
-    }
-    ++m_size_;
-    newTail.release();
+  void push_back(const_reference value) { linkBack(createNode(value)); }
+  void push_back(value_type &&value) {
+    linkBack(createNode(std::move(value)));
   }
 
   void pop_back() {
     if (empty()) {
       throw std::out_of_range("Error: List is empty.");
     } else {
-      // ListNode *oldTail = tail_;
-      std::unique_ptr<ListNode> oldTail(tail_);
+      ListNode *oldTail = tail_;
       if (m_size_ < 2) {
         head_ = tail_ = nullptr;
       } else {
@@ -189,29 +206,20 @@ class List {
         tail_->next_ = nullptr;
       }
       --m_size_;
+      destroyNode(oldTail);
     }
   }
 
-  void push_front(const_reference value) {
-    std::unique_ptr<ListNode> newHead(new ListNode(value));
-    // ListNode *newHead = new ListNode(value);
-    if (head_) {
-      newHead->next_ = head_;
-      head_->prev_ = newHead.get();
-      head_ = newHead.get();
-    } else {
-      head_ = tail_ = newHead.get();
-    }
-    ++m_size_;
-    newHead.release();
+  void push_front(const_reference value) { linkFront(createNode(value)); }
+  void push_front(value_type &&value) {
+    linkFront(createNode(std::move(value)));
   }
 
   void pop_front() {
     if (empty()) {
       throw std::out_of_range("Error: List is empty.");
     } else {
-      // ListNode *oldHead = head_;
-      std::unique_ptr<ListNode> oldHead(head_);
+      ListNode *oldHead = head_;
       if (m_size_ < 2) {
         head_ = tail_ = nullptr;
       } else {
@@ -219,12 +227,14 @@ class List {
         head_->prev_ = nullptr;
       }
       --m_size_;
+      destroyNode(oldHead);
     }
   }
   void swap(List &other) {
     std::swap(m_size_, other.m_size_);
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
+    std::swap(alloc_, other.alloc_);
   }
 
   ListNode *merge_sorted_lists(ListNode *left, ListNode *right) {
@@ -395,39 +405,24 @@ class List {
   }
 
   void append_value(iterator pos, const_reference value) {
-    ListNode *current = pos.current_;
-    ListNode *prev = current->prev_;
-    ListNode *newElement = new ListNode(value);
-
-    newElement->next_ = current;
-    newElement->prev_ = prev;
-    current->prev_ = newElement;
-    prev->next_ = newElement;
-    ++m_size_;
+    linkBefore(pos, createNode(value));
   }
 
   iterator insert(iterator pos, const_reference value) {
-    if (pos == begin()) {
-      push_front(value);
-      pos = head_;
-    } else if (pos == end()) {
-      push_back(value);
-      pos = tail_;
-    } else {
-      append_value(pos, value);
-      --pos;
-    }
-    return pos;
+    return insertNode(pos, createNode(value));
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return insertNode(pos, createNode(std::move(value)));
   }
 
   void erase(iterator pos) {
-    std::unique_ptr<ListNode> current(pos.current_);
-    if (current.get() == head_ && current.get() == tail_) {
+    ListNode *current = pos.current_;
+    if (current == head_ && current == tail_) {
       head_ = tail_ = nullptr;
-    } else if (current.get() == head_) {
+    } else if (current == head_) {
       head_ = head_->next_;
       head_->prev_ = nullptr;
-    } else if (current.get() == tail_) {
+    } else if (current == tail_) {
       tail_ = tail_->prev_;
       tail_->next_ = nullptr;
     } else {
@@ -435,30 +430,93 @@ class List {
       current->next_->prev_ = current->prev_;
     }
     --m_size_;
+    destroyNode(current);
   }
 
+  // элемент строится один раз, прямо в узле
   template <class... Args>
   iterator emplace(const_iterator pos, Args &&...args) {
-    value_type newArg(std::forward<Args>(args)...);
-    return insert(pos, newArg);
+    return insertNode(pos, createNode(std::forward<Args>(args)...));
   }
 
   template <class... Args>
   void emplace_back(Args &&...args) {
-    value_type newArg(std::forward<Args>(args)...);
-    push_back(newArg);
+    linkBack(createNode(std::forward<Args>(args)...));
   }
 
   template <class... Args>
   void emplace_front(Args &&...args) {
-    value_type newArg(std::forward<Args>(args)...);
-    push_front(newArg);
+    linkFront(createNode(std::forward<Args>(args)...));
   }
 
  private:
+  // перевешивание уже созданного узла этого списка; узлы чужих списков и
+  // аллокаторов сюда передавать нельзя
+  void linkBack(ListNode *newTail) {
+    if (tail_) {
+      newTail->prev_ = tail_;
+      tail_->next_ = newTail;
+      tail_ = newTail;
+    } else {
+      tail_ = head_ = newTail;
+    }
+    ++m_size_;
+  }
+
+  void linkFront(ListNode *newHead) {
+    if (head_) {
+      newHead->next_ = head_;
+      head_->prev_ = newHead;
+      head_ = newHead;
+    } else {
+      head_ = tail_ = newHead;
+    }
+    ++m_size_;
+  }
+
+  void linkBefore(iterator pos, ListNode *newElement) {
+    ListNode *current = pos.current_;
+    ListNode *prev = current->prev_;
+
+    newElement->next_ = current;
+    newElement->prev_ = prev;
+    current->prev_ = newElement;
+    prev->next_ = newElement;
+    ++m_size_;
+  }
+
+  iterator insertNode(iterator pos, ListNode *node) {
+    if (pos == begin()) {
+      linkFront(node);
+    } else if (pos == end()) {
+      linkBack(node);
+    } else {
+      linkBefore(pos, node);
+    }
+    return iterator(node);
+  }
+
+  template <class... Args>
+  ListNode *createNode(Args &&...args) {
+    ListNode *node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, std::in_place,
+                             std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+  void destroyNode(ListNode *node) {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
   size_type m_size_;
   ListNode *head_;
   ListNode *tail_;
+  node_allocator alloc_;
 };
 
 }  // namespace s21
@@ -4,23 +4,39 @@
 
 namespace s21 {
 
-template <class K, class T>
-class map : public Tree<K, T> {
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class map : public Tree<K, T, Compare, Allocator> {
  public:
-  using RBT = typename s21::Tree<K, T>;
+  using RBT = typename s21::Tree<K, T, Compare, Allocator>;
+  using allocator_type = Allocator;
   using Key = K;
   using key_type = K;
   using mapped_type = T;
+  using key_compare = Compare;
   using value_type = std::pair<const key_type, mapped_type>;
   using size_type = size_t;
   using iterator = typename RBT::mapIterator;
   using insert_result = std::pair<iterator, bool>;
+  using node_type = typename RBT::node_type;
+  using insert_return_type = typename RBT::insert_return_type;
   //  using pack_pair = s21::vector<std::pair<iterator, bool>>;
 
  public:
   map() : RBT(){};
+  explicit map(const Compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : RBT(comp, alloc) {}
+  explicit map(const allocator_type &alloc) : RBT(alloc){};
 
-  map(std::initializer_list<value_type> const &items);
+  // упорядоченный вход собирается за O(n), иначе сначала сортируется
+  template <class InputIt,
+            class = typename std::iterator_traits<InputIt>::iterator_category>
+  map(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, false, true);
+  }
+  map(std::initializer_list<value_type> const &items)
+      : map(items.begin(), items.end()) {}
   map(const map &m) : RBT(m){};
   map(map &&m) noexcept { *this = std::move(m); }
   ~map() = default;
@@ -37,79 +53,94 @@ class map : public Tree<K, T> {
   T &operator[](const Key &key);
 
   void clear() noexcept;
+  // вход уже упорядочен по ключу: проверка порядка пропускается
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, true, true);
+  }
   insert_result insert(const value_type &value);
+  insert_result insert(value_type &&value) {
+    return RBT::insertUnique(std::move(value));
+  }
+  // узел из extract встаёт без выделения памяти, если ключа ещё нет
+  insert_return_type insert(node_type &&node) {
+    return RBT::insertNodeUnique(std::move(node));
+  }
   insert_result insert(const K &key, const T &value);
   insert_result insert_or_assign(const K &key, const T &value);
+  // hint - позиция сразу за новым ключом (или перед ним): с верным hint
+  // вставка не спускается от корня
+  iterator insert(iterator hint, const value_type &value) {
+    return RBT::insertHint(hint, value, true);
+  }
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return RBT::emplaceHint(hint, true, std::forward<Args>(args)...);
+  }
+  // значение строится из args, только если ключа ещё нет
+  template <class... Args>
+  insert_result try_emplace(const key_type &key, Args &&...args) {
+    return RBT::tryEmplace(key, std::forward<Args>(args)...);
+  }
   void erase(iterator pos);
-  void swap(map &other) { std::swap(RBT::root, other.root); }
+  void swap(map &other) { RBT::swapTree(other); }
   void merge(map &other);
-  bool contains(const key_type &key) {
-    return RBT::containsNode(key, RBT::root);
-  }
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
   friend RBT;
 };
-template <class K, class T>
-map<K, T>::map(const std::initializer_list<value_type> &items) {
-  for (auto i = items.begin(); i != items.end(); ++i) {
-    RBT::addnode(*i, RBT::root, false);
-  }
-}
-template <class K, class T>
-map<K, T> &map<K, T>::operator=(map &&m) noexcept {
-  this->root = m.root;
-  m.root = nullptr;
+template <class K, class T, class Compare, class Allocator>
+map<K, T, Compare, Allocator> &map<K, T, Compare, Allocator>::operator=(
+    map &&m) noexcept {
+  RBT::swapTree(m);
   return *this;
 }
-template <class K, class T>
-void map<K, T>::clear() noexcept {
+template <class K, class T, class Compare, class Allocator>
+void map<K, T, Compare, Allocator>::clear() noexcept {
   RBT::destroy(this->root);
   this->root = nullptr;
 }
-template <class K, class T>
-typename map<K, T>::insert_result map<K, T>::insert(
-    const map::value_type &value) {
-  return RBT::addnode(value, this->root, false);
+template <class K, class T, class Compare, class Allocator>
+typename map<K, T, Compare, Allocator>::insert_result
+map<K, T, Compare, Allocator>::insert(const map::value_type &value) {
+  return RBT::insertUnique(value);
 }
-template <class K, class T>
-typename map<K, T>::insert_result map<K, T>::insert(const K &key,
-                                                    const T &value) {
-  value_type x(key, value);
-  return RBT::addnode(x, this->root, false);
+template <class K, class T, class Compare, class Allocator>
+typename map<K, T, Compare, Allocator>::insert_result
+map<K, T, Compare, Allocator>::insert(const K &key, const T &value) {
+  return RBT::tryEmplace(key, value);
 }
-template <class K, class T>
-typename map<K, T>::insert_result map<K, T>::insert_or_assign(const K &key,
-                                                              const T &value) {
-  value_type x(key, value);
-  return RBT::addnode(x, this->root, true);
+template <class K, class T, class Compare, class Allocator>
+typename map<K, T, Compare, Allocator>::insert_result
+map<K, T, Compare, Allocator>::insert_or_assign(const K &key, const T &value) {
+  insert_result result = RBT::tryEmplace(key, value);
+  if (!result.second) result.first->second = value;
+  return result;
 }
-template <class K, class T>
-void map<K, T>::merge(map &other) {
-  for (auto it = other.begin(); it != other.end(); ++it) {
-    RBT::addnode(*it, this->root, false);
-  }
+// узлы перевешиваются из other; ключи, которые уже есть, остаются там
+template <class K, class T, class Compare, class Allocator>
+void map<K, T, Compare, Allocator>::merge(map &other) {
+  RBT::mergeNodes(other, true);
 }
-template <class K, class T>
-void map<K, T>::erase(map::iterator pos) {
+template <class K, class T, class Compare, class Allocator>
+void map<K, T, Compare, Allocator>::erase(map::iterator pos) {
   typename RBT::tnode *data = RBT::get_current(pos);
   RBT::eraseNode(data);
   --this->tree_size;
 }
 
-template <class K, class T>
+template <class K, class T, class Compare, class Allocator>
 template <class... Args>
-std::vector<std::pair<typename map<K, T>::iterator, bool>> map<K, T>::emplace(
-    Args &&...args) {
+std::vector<std::pair<typename map<K, T, Compare, Allocator>::iterator, bool>>
+map<K, T, Compare, Allocator>::emplace(Args &&...args) {
   std::vector<std::pair<iterator, bool>> result;
-  value_type newArg(std::forward<Args>(args)...);
-  result.push_back(insert(newArg));
+  result.push_back(RBT::emplaceUnique(std::forward<Args>(args)...));
   return result;
 }
-template <class K, class T>
-T &map<K, T>::at(const K &key) {
+template <class K, class T, class Compare, class Allocator>
+T &map<K, T, Compare, Allocator>::at(const K &key) {
   typename RBT::tnode *result = this->find_data_at(key, this->root);
   if (result == nullptr) {
     throw std::out_of_range("map()");
@@ -117,16 +148,10 @@ T &map<K, T>::at(const K &key) {
     return result->data.second;
   }
 }
-template <class K, class T>
-T &map<K, T>::operator[](const Key &key) {
-  typename RBT::tnode *result = this->find_data_at(key, this->root);
-  mapped_type add_data{};
-  if (result == nullptr) {
-    value_type add_node(key, add_data);
-    RBT::addnode(add_node, this->root, false);
-  }
-  result = this->find_data_at(key, this->root);
-  return result->data.second;
+// один спуск: значение по умолчанию строится, только если ключа нет
+template <class K, class T, class Compare, class Allocator>
+T &map<K, T, Compare, Allocator>::operator[](const Key &key) {
+  return RBT::tryEmplace(key).first->second;
 }
 }  // namespace s21
 
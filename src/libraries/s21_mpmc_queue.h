@@ -0,0 +1,275 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Ограниченная очередь для многих производителей и потребителей (схема
+// Вьюкова). У каждого слота свой номер: pos - слот свободен для записи
+// с позицией pos, pos + 1 - в нём лежит элемент для чтения с позицией
+// pos. Поток занимает позицию одним CAS и дальше работает только со своим
+// слотом, поэтому производители и потребители не мешают друг другу.
+// front() из s21::Queue здесь нет: между front и pop элемент может
+// забрать другой поток, поэтому pop сразу отдаёт элемент
+template <class T, std::size_t Capacity>
+class MpmcQueue {
+  static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U,
+                "MpmcQueue: Capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  MpmcQueue() {
+    for (size_type i = 0U; i < Capacity; ++i)
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+  ~MpmcQueue();
+
+  static constexpr size_type capacity() noexcept { return Capacity; }
+  // пока другие потоки работают с очередью, значение приблизительное
+  [[nodiscard]] size_type size() const noexcept;
+  [[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+
+  // false - очередь полна
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+  // false - очередь пуста
+  bool try_pop(reference out);
+
+  // ждут места или элемента: крутятся, уступают ядро, потом засыпают
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <class... Args>
+  void emplace(Args &&...args);
+  void pop(reference out);
+
+ private:
+  static constexpr size_type kMask = Capacity - 1U;
+  // попыток перед тем, как уступить ядро, и перед тем, как уснуть
+  static constexpr int kSpins = 64;
+  static constexpr int kYields = 16;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    value_type *item() noexcept {
+      return reinterpret_cast<value_type *>(bytes);
+    }
+  };
+  // спящие потоки одной стороны
+  struct Sleepers {
+    std::atomic<int> count{0};
+    std::condition_variable wake;
+  };
+
+  static std::ptrdiff_t distance(size_type from, size_type to) noexcept {
+    return static_cast<std::ptrdiff_t>(to - from);
+  }
+  Cell *claimWrite(size_type &pos);
+  Cell *claimRead(size_type &pos);
+  // сами операции, без пробуждения другой стороны
+  template <class... Args>
+  bool pushSlot(Args &&...args);
+  bool popSlot(reference out);
+  template <class TryOp>
+  void waitUntil(TryOp try_op, Sleepers &sleepers);
+  void wakeOne(Sleepers &sleepers);
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0U};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0U};
+  alignas(kCacheLine) Cell cells_[Capacity];
+  // нужны только ждущим push и pop
+  alignas(kCacheLine) std::mutex park_mutex_;
+  Sleepers producers_;
+  Sleepers consumers_;
+};
+
+template <class T, std::size_t Capacity>
+MpmcQueue<T, Capacity>::~MpmcQueue() {
+  size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != end; ++pos)
+    cells_[pos & kMask].item()->~T();
+}
+
+template <class T, std::size_t Capacity>
+typename MpmcQueue<T, Capacity>::size_type MpmcQueue<T, Capacity>::size()
+    const noexcept {
+  std::ptrdiff_t count =
+      distance(dequeue_pos_.load(std::memory_order_acquire),
+               enqueue_pos_.load(std::memory_order_acquire));
+  if (count < 0) return 0U;
+  return count > static_cast<std::ptrdiff_t>(Capacity)
+             ? Capacity
+             : static_cast<size_type>(count);
+}
+
+// занимает свободный слот; nullptr - очередь полна
+template <class T, std::size_t Capacity>
+typename MpmcQueue<T, Capacity>::Cell *MpmcQueue<T, Capacity>::claimWrite(
+    size_type &pos) {
+  pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell *cell = &cells_[pos & kMask];
+    std::ptrdiff_t diff =
+        distance(pos, cell->sequence.load(std::memory_order_acquire));
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U,
+                                             std::memory_order_relaxed))
+        return cell;
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// занимает слот с готовым элементом; nullptr - очередь пуста
+template <class T, std::size_t Capacity>
+typename MpmcQueue<T, Capacity>::Cell *MpmcQueue<T, Capacity>::claimRead(
+    size_type &pos) {
+  pos = dequeue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell *cell = &cells_[pos & kMask];
+    std::ptrdiff_t diff =
+        distance(pos + 1U, cell->sequence.load(std::memory_order_acquire));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1U,
+                                             std::memory_order_relaxed))
+        return cell;
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Занятый слот обязан заполниться, иначе на нём встанут все потребители.
+// Поэтому в слоте элемент строится, только если конструктор не бросает;
+// иначе он строится заранее и переносится в слот
+template <class T, std::size_t Capacity>
+template <class... Args>
+bool MpmcQueue<T, Capacity>::pushSlot(Args &&...args) {
+  size_type pos = 0U;
+  if constexpr (std::is_nothrow_constructible<T, Args &&...>::value) {
+    Cell *cell = claimWrite(pos);
+    if (cell == nullptr) return false;
+    ::new (static_cast<void *>(cell->item())) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1U, std::memory_order_release);
+  } else {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcQueue: T must be nothrow move constructible");
+    value_type value(std::forward<Args>(args)...);
+    Cell *cell = claimWrite(pos);
+    if (cell == nullptr) return false;
+    ::new (static_cast<void *>(cell->item())) T(std::move(value));
+    cell->sequence.store(pos + 1U, std::memory_order_release);
+  }
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+bool MpmcQueue<T, Capacity>::popSlot(reference out) {
+  size_type pos = 0U;
+  Cell *cell = claimRead(pos);
+  if (cell == nullptr) return false;
+  // слот освобождается, даже если присваивание бросит
+  struct Release {
+    Cell *cell;
+    size_type next;
+    ~Release() {
+      cell->item()->~T();
+      cell->sequence.store(next, std::memory_order_release);
+    }
+  };
+  {
+    Release release{cell, pos + Capacity};
+    out = std::move(*cell->item());
+  }
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+template <class... Args>
+bool MpmcQueue<T, Capacity>::try_emplace(Args &&...args) {
+  if (!pushSlot(std::forward<Args>(args)...)) return false;
+  wakeOne(consumers_);
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+bool MpmcQueue<T, Capacity>::try_pop(reference out) {
+  if (!popSlot(out)) return false;
+  wakeOne(producers_);
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+template <class... Args>
+void MpmcQueue<T, Capacity>::emplace(Args &&...args) {
+  if constexpr (std::is_nothrow_constructible<T, Args &&...>::value) {
+    waitUntil([&] { return pushSlot(std::forward<Args>(args)...); },
+              producers_);
+  } else {
+    // элемент строится один раз, а не на каждой попытке
+    value_type value(std::forward<Args>(args)...);
+    waitUntil([&] { return pushSlot(std::move(value)); }, producers_);
+  }
+  wakeOne(consumers_);
+}
+
+template <class T, std::size_t Capacity>
+void MpmcQueue<T, Capacity>::pop(reference out) {
+  waitUntil([&] { return popSlot(out); }, consumers_);
+  wakeOne(producers_);
+}
+
+// Перед сном поток отмечается в sleepers.count и ещё раз пробует под
+// park_mutex_. Другая сторона после успешной операции смотрит на count
+// (барьеры с обеих сторон не дают обоим пропустить друг друга) и будит
+// через тот же мьютекс, поэтому пробуждение не теряется
+template <class T, std::size_t Capacity>
+template <class TryOp>
+void MpmcQueue<T, Capacity>::waitUntil(TryOp try_op, Sleepers &sleepers) {
+  for (int attempt = 0; attempt < kSpins + kYields; ++attempt) {
+    if (try_op()) return;
+    if (attempt >= kSpins) std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(park_mutex_);
+  sleepers.count.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  while (!try_op()) sleepers.wake.wait(lock);
+  sleepers.count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <class T, std::size_t Capacity>
+void MpmcQueue<T, Capacity>::wakeOne(Sleepers &sleepers) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleepers.count.load(std::memory_order_relaxed) == 0) return;
+  { std::lock_guard<std::mutex> lock(park_mutex_); }
+  sleepers.wake.notify_one();
+}
+
+}  // namespace s21
+
+#endif  // S21_MPMC_QUEUE_H
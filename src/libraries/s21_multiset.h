@@ -5,19 +5,34 @@
 
 namespace s21 {
 
-template <class Key, class T = int>
-class multiset : public Tree<Key, T> {
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class multiset : public Tree<Key, int, Compare, Allocator> {
  public:
-  using RBT = s21::Tree<Key, T>;
+  using RBT = s21::Tree<Key, int, Compare, Allocator>;
+  using allocator_type = Allocator;
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
   using iterator = typename RBT::mapIterator;
   using const_iterator = typename RBT::constMapIterator;
   using pairiterator = std::pair<iterator, iterator>;
+  using node_type = typename RBT::node_type;
   using size_type = size_t;
 
   multiset() : RBT(){};
-  multiset(std::initializer_list<value_type> const &item);
+  explicit multiset(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : RBT(comp, alloc) {}
+  explicit multiset(const allocator_type &alloc) : RBT(alloc){};
+  // упорядоченный вход собирается за O(n), иначе сначала сортируется
+  template <class InputIt,
+            class = typename std::iterator_traits<InputIt>::iterator_category>
+  multiset(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, false, false);
+  }
+  multiset(std::initializer_list<value_type> const &items)
+      : multiset(items.begin(), items.end()) {}
   multiset(const multiset &ms) : RBT(ms){};
   multiset(multiset &&ms) noexcept { *this = std::move(ms); }
   ~multiset() = default;
@@ -32,130 +47,82 @@ class multiset : public Tree<Key, T> {
   };
 
   void clear() noexcept;  // вопрос об обнулении узлов
+  // вход уже упорядочен по ключу: проверка порядка пропускается
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, true, false);
+  }
   iterator insert(const value_type &value);
+  iterator insert(value_type &&value) {
+    return RBT::insertMulti(std::move(value));
+  }
+  iterator insert(node_type &&node) {
+    return RBT::insertNodeMulti(std::move(node));
+  }
+  // с верным hint вставка не спускается от корня
+  iterator insert(iterator hint, const value_type &value) {
+    return RBT::insertHint(hint, value, false);
+  }
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return RBT::emplaceHint(hint, false, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<Args>(args)...),
+                            std::tuple<>());
+  }
   void erase(iterator pos);
   void swap(multiset &other);
   void merge(multiset &other);
 
-  iterator find(const Key &key);
-  bool contains(const key_type &key) {
-    return RBT::containsNode(key, this->root);
+  pairiterator equal_range(const Key &key) {
+    return pairiterator(RBT::lower_bound(key), RBT::upper_bound(key));
+  }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  pairiterator equal_range(const Key2 &key) {
+    return pairiterator(RBT::lower_bound(key), RBT::upper_bound(key));
   }
-
-  size_type count(const Key &key);
-
-  pairiterator equal_range(const Key &key);
-  iterator lower_bound(const Key &key);
-  iterator upper_bound(const Key &key);
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args &&...args);
 };
-template <class Key, class T>
-multiset<Key, T>::multiset(const std::initializer_list<value_type> &item) {
-  for (auto i = item.begin(); i != item.end(); ++i) {
-    auto data = std::pair(*i, false);
-    RBT::addnodeit(data, RBT::root);
-  }
-}
-template <class Key, class T>
-multiset<Key, T> &multiset<Key, T>::operator=(multiset &&ms) noexcept {
-  this->root = ms.root;
-  ms.root = nullptr;
-  delete ms.root;
+template <class Key, class Compare, class Allocator>
+multiset<Key, Compare, Allocator> &multiset<Key, Compare, Allocator>::operator=(
+    multiset &&ms) noexcept {
+  RBT::swapTree(ms);
   return *this;
 }
-template <class Key, class T>
-typename multiset<Key, T>::iterator multiset<Key, T>::insert(
-    const value_type &value) {
-  auto data = std::pair(value, false);
-  return RBT::addnodeit(data, this->root);
+template <class Key, class Compare, class Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::insert(const value_type &value) {
+  return RBT::insertMulti(value);
 }
-template <class Key, class T>
-void multiset<Key, T>::erase(multiset::iterator pos) {
+template <class Key, class Compare, class Allocator>
+void multiset<Key, Compare, Allocator>::erase(multiset::iterator pos) {
   typename RBT::tnode *data = RBT::get_current(pos);
   RBT::eraseNode(data);
   --this->tree_size;
 }
-template <class Key, class T>
-void multiset<Key, T>::merge(multiset &other) {
-  for (auto &it : other) {
-    RBT::addnodeit(it, this->root);
-  }
-}
-template <class Key, class T>
-typename multiset<Key, T>::iterator multiset<Key, T>::find(const Key &key) {
-  key_type add_item{};
-  iterator item = new typename RBT::tnode(std::pair(add_item, false));
-  for (auto i = this->begin(); i != this->end(); ++i) {
-    auto cur = RBT::get_current(i);
-    if (cur->data.first == key) {
-      item.clean_iterator();
-      return i;
-    }
-  }
-  item.clean_iterator();
-  return item;
-}
-template <class Key, class T>
-typename multiset<Key, T>::size_type multiset<Key, T>::count(const Key &key) {
-  size_type result = 0U;
-  for (auto i = this->begin(); i != this->end(); ++i) {
-    auto cur = RBT::get_current(i);
-    if (cur->data.first == key) result++;
-  }
-  return result;
-}
-template <class Key, class T>
-typename multiset<Key, T>::iterator multiset<Key, T>::lower_bound(
-    const Key &key) {
-  iterator item = this->begin();
-  for (auto i = this->begin(); i != this->end(); ++i) {
-    item = RBT::get_current(i);
-    if (item->first == key) {
-      return (item);
-    } else if (item->first > key)
-      return item;
-  }
-  return item;
-}
-template <class Key, class T>
-typename multiset<Key, T>::iterator multiset<Key, T>::upper_bound(
-    const Key &key) {
-  key_type nul{};
-  iterator item = new typename RBT::tnode(std::pair(nul, false));
-  for (auto i = this->begin(); i != this->end(); ++i) {
-    if (i->first > key) {
-      item.clean_iterator();
-      return i;
-    }
-  }
-  item.clean_iterator();
-  return item;
-}
-template <class Key, class T>
-typename multiset<Key, T>::pairiterator multiset<Key, T>::equal_range(
-    const Key &key) {
-  std::pair<iterator, iterator> result(lower_bound(key), upper_bound(key));
-  return result;
+template <class Key, class Compare, class Allocator>
+void multiset<Key, Compare, Allocator>::merge(multiset &other) {
+  RBT::mergeNodes(other, false);
 }
-template <class Key, class T>
+template <class Key, class Compare, class Allocator>
 template <class... Args>
-std::vector<std::pair<typename multiset<Key, T>::iterator, bool>>
-multiset<Key, T>::emplace(Args &&...args) {
+std::vector<
+    std::pair<typename multiset<Key, Compare, Allocator>::iterator, bool>>
+multiset<Key, Compare, Allocator>::emplace(Args &&...args) {
   std::vector<std::pair<iterator, bool>> result;
-  result.push_back(std::pair(insert(std::forward<Args>(args)...), true));
+  iterator pos = RBT::emplaceMulti(
+      std::piecewise_construct,
+      std::forward_as_tuple(std::forward<Args>(args)...), std::tuple<>());
+  result.push_back(std::pair(pos, true));
   return result;
 }
-template <class Key, class T>
-void multiset<Key, T>::swap(multiset &other) {
-  std::swap(this->root, other.root);
-  auto temp_size = this->tree_size;
-  this->tree_size = other.tree_size;
-  other.tree_size = temp_size;
+template <class Key, class Compare, class Allocator>
+void multiset<Key, Compare, Allocator>::swap(multiset &other) {
+  RBT::swapTree(other);
 }
-template <class Key, class T>
-void multiset<Key, T>::clear() noexcept {
+template <class Key, class Compare, class Allocator>
+void multiset<Key, Compare, Allocator>::clear() noexcept {
   RBT::destroy(this->root);
   this->root = nullptr;
 }
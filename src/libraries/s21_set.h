@@ -4,18 +4,35 @@
 
 namespace s21 {
 
-template <class Key, class T = int>
-class set : public Tree<Key, T> {
+// ключ хранится в паре с пустым int: узлы общие с map
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class set : public Tree<Key, int, Compare, Allocator> {
  public:
-  using RBT = typename s21::Tree<Key, T>;
+  using RBT = typename s21::Tree<Key, int, Compare, Allocator>;
+  using allocator_type = Allocator;
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
   using size_type = size_t;
   using iterator = typename RBT::mapIterator;
   using insert_result = std::pair<iterator, bool>;
+  using node_type = typename RBT::node_type;
+  using insert_return_type = typename RBT::insert_return_type;
 
   set() : RBT(){};
-  set(std::initializer_list<value_type> const &items);
+  explicit set(const Compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : RBT(comp, alloc) {}
+  explicit set(const allocator_type &alloc) : RBT(alloc){};
+  // упорядоченный вход собирается за O(n), иначе сначала сортируется
+  template <class InputIt,
+            class = typename std::iterator_traits<InputIt>::iterator_category>
+  set(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, false, true);
+  }
+  set(std::initializer_list<value_type> const &items)
+      : set(items.begin(), items.end()) {}
   set(const set &s) : RBT(s){};
   set(set &&s) noexcept { *this = std::move(s); }
   ~set() = default;
@@ -30,84 +47,76 @@ class set : public Tree<Key, T> {
   };
 
   void clear() noexcept;
+  // вход уже упорядочен по ключу: проверка порядка пропускается
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    RBT::assignRange(first, last, true, true);
+  }
   insert_result insert(const value_type &value);
+  insert_result insert(value_type &&value) {
+    return RBT::insertUnique(std::move(value));
+  }
+  insert_return_type insert(node_type &&node) {
+    return RBT::insertNodeUnique(std::move(node));
+  }
+  // с верным hint вставка не спускается от корня
+  iterator insert(iterator hint, const value_type &value) {
+    return RBT::insertHint(hint, value, true);
+  }
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return RBT::emplaceHint(hint, true, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<Args>(args)...),
+                            std::tuple<>());
+  }
   void erase(iterator pos);
   void swap(set &other);
   void merge(set &other);
-  iterator find(const Key &key);
-  bool contains(const key_type &key) {
-    return RBT::containsNode(key, this->root);
-  }
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args &&...args);
 };
-template <class Key, class T>
-set<Key, T>::set(const std::initializer_list<value_type> &items) {
-  for (auto i = items.begin(); i != items.end(); ++i) {
-    auto data = std::pair(*i, false);
-    RBT::addnode(data, this->root, false);
-  }
-}
-template <class Key, class T>
-set<Key, T> &set<Key, T>::operator=(set &&s) noexcept {
-  this->root = s.root;
-  s.root = nullptr;
+template <class Key, class Compare, class Allocator>
+set<Key, Compare, Allocator> &set<Key, Compare, Allocator>::operator=(
+    set &&s) noexcept {
+  RBT::swapTree(s);
   return *this;
 }
-template <class Key, class T>
-void set<Key, T>::clear() noexcept {
+template <class Key, class Compare, class Allocator>
+void set<Key, Compare, Allocator>::clear() noexcept {
   RBT::destroy(this->root);
   this->root = nullptr;
 }
-template <class Key, class T>
-typename set<Key, T>::insert_result set<Key, T>::insert(
-    const value_type &value) {
-  auto data = std::pair(value, false);
-  return RBT::addnode(data, this->root, false);
+template <class Key, class Compare, class Allocator>
+typename set<Key, Compare, Allocator>::insert_result
+set<Key, Compare, Allocator>::insert(const value_type &value) {
+  return RBT::insertUnique(value);
 }
 
-template <class Key, class T>
-void set<Key, T>::erase(iterator pos) {
+template <class Key, class Compare, class Allocator>
+void set<Key, Compare, Allocator>::erase(iterator pos) {
   typename RBT::tnode *data = RBT::get_current(pos);
   RBT::eraseNode(data);
   --this->tree_size;
 }
 
-template <class Key, class T>
-void set<Key, T>::merge(set &other) {
-  for (auto &it : other) {
-    RBT::addnode(it, this->root, false);
-  }
-}
-template <class Key, class T>
-typename set<Key, T>::iterator set<Key, T>::find(const Key &key) {
-  key_type add_item{};
-  iterator item = new typename RBT::tnode(std::pair(add_item, false));
-  for (auto i = this->begin(); i != this->end(); ++i) {
-    auto cur = RBT::get_current(i);
-    if (cur->data.first == key) {
-      item.clean_iterator();
-      return i;
-    }
-  }
-  item.clean_iterator();
-  return item;
+template <class Key, class Compare, class Allocator>
+void set<Key, Compare, Allocator>::merge(set &other) {
+  RBT::mergeNodes(other, true);
 }
-template <class K, class T>
+template <class K, class Compare, class Allocator>
 template <class... Args>
-std::vector<std::pair<typename set<K, T>::iterator, bool>> set<K, T>::emplace(
-    Args &&...args) {
+std::vector<std::pair<typename set<K, Compare, Allocator>::iterator, bool>>
+set<K, Compare, Allocator>::emplace(Args &&...args) {
   std::vector<std::pair<iterator, bool>> result;
-  result.push_back(insert(std::forward<Args>(args)...));
+  result.push_back(RBT::emplaceUnique(
+      std::piecewise_construct,
+      std::forward_as_tuple(std::forward<Args>(args)...), std::tuple<>()));
   return result;
 }
-template <class Key, class T>
-void set<Key, T>::swap(set &other) {
-  std::swap(this->root, other.root);
-  auto temp_size = this->tree_size;
-  this->tree_size = other.tree_size;
-  other.tree_size = temp_size;
+template <class Key, class Compare, class Allocator>
+void set<Key, Compare, Allocator>::swap(set &other) {
+  RBT::swapTree(other);
 }
 
 }  // namespace s21
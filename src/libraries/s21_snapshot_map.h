@@ -0,0 +1,449 @@
+#ifndef S21_SNAPSHOT_MAP_H
+#define S21_SNAPSHOT_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "node_pool.h"
+
+namespace s21 {
+
+// Отображение для редко меняющихся данных, которые читаются из многих
+// потоков (схема RCU). Каждое изменение строит новую неизменяемую версию
+// и публикует её одной атомарной записью; читатель берёт snapshot и ищет
+// в нём без блокировок и без атомарных операций на узлах.
+// Узлы s21::map хранят указатель на родителя, поэтому общий с другой
+// версией узел у него невозможен. Здесь своё AVL-дерево без родителей:
+// запись копирует только путь от корня до изменённого ключа, остальные
+// поддеревья у версий общие и держатся счётчиком ссылок
+template <class K, class V, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, V>>>
+class snapshot_map {
+  struct Node;
+  struct Version;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  // Неизменяемая версия. Пока snapshot жив, версия не освобождается;
+  // snapshot не должен пережить отображение
+  class snapshot {
+   public:
+    snapshot() = default;
+    snapshot(const snapshot &) = delete;
+    snapshot &operator=(const snapshot &) = delete;
+    snapshot(snapshot &&other) noexcept { swap(other); }
+    snapshot &operator=(snapshot &&other) noexcept {
+      snapshot(std::move(other)).swap(*this);
+      return *this;
+    }
+    ~snapshot();
+
+    [[nodiscard]] size_type size() const noexcept {
+      return version_ ? version_->size : 0U;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+    // nullptr - ключа нет
+    const mapped_type *find(const K &key) const;
+    bool contains(const K &key) const { return find(key) != nullptr; }
+    const mapped_type &at(const K &key) const;
+    // обход по возрастанию ключа
+    template <class Fn>
+    void for_each(Fn &&fn) const;
+
+    void swap(snapshot &other) noexcept {
+      std::swap(owner_, other.owner_);
+      std::swap(version_, other.version_);
+    }
+
+   private:
+    friend snapshot_map;
+    snapshot(const snapshot_map *owner, Version *version)
+        : owner_(owner), version_(version) {}
+
+    const snapshot_map *owner_{};
+    Version *version_{};
+  };
+
+  snapshot_map() : snapshot_map(Compare()) {}
+  explicit snapshot_map(const Compare &comp,
+                        const allocator_type &alloc = allocator_type());
+  snapshot_map(std::initializer_list<value_type> const &items);
+  snapshot_map(const snapshot_map &) = delete;
+  snapshot_map &operator=(const snapshot_map &) = delete;
+  ~snapshot_map();
+
+  // текущая версия; читатель не ждёт писателей
+  snapshot get_snapshot() const;
+  // разовый поиск в текущей версии
+  std::optional<V> find(const K &key) const;
+  bool contains(const K &key) const { return get_snapshot().contains(key); }
+  size_type size() const { return get_snapshot().size(); }
+  bool empty() const { return size() == 0U; }
+
+  // Писатели выстраиваются на мьютексе, каждый вызов публикует версию.
+  // true - ключа не было и пара вставлена, false - значение заменено
+  bool insert_or_assign(const K &key, const V &value);
+  size_type erase(const K &key);
+  void clear();
+
+ private:
+  struct Node {
+    template <class... Args>
+    Node(Node *l, Node *r, Args &&...args)
+        : data(std::forward<Args>(args)...), left(l), right(r) {}
+
+    value_type data;
+    Node *left;
+    Node *right;
+    int height{1};
+    // родители и версии, которые ссылаются на узел; меняется только
+    // под write_mutex_
+    size_type refs{0U};
+  };
+  struct Version {
+    Node *root{};
+    size_type size{};
+    std::atomic<size_type> readers{0U};
+    std::atomic<bool> retired{false};
+  };
+
+  static int height(const Node *node) noexcept {
+    return node ? node->height : 0;
+  }
+  const Node *findNode(const Node *node, const K &key) const;
+
+  // построение новой версии; все созданные узлы попадают в fresh_
+  template <class... Args>
+  Node *make(Node *left, Node *right, Args &&...args);
+  Node *balance(Node *left, const value_type &data, Node *right);
+  Node *insert(Node *node, const K &key, const V &value, bool &inserted);
+  Node *erase(Node *node, const K &key);
+  Node *eraseMin(Node *node, const value_type *&min);
+  void sweepFresh() noexcept;
+  void release(Node *node) const noexcept;
+
+  template <class Build>
+  void publish(Build build);
+  void reclaim() const noexcept;
+  void freeVersion(Version *version) const noexcept;
+
+  // текущая версия; в acquiring_ отмечаются читатели, которые уже
+  // прочитали current_, но ещё не записались в readers
+  std::atomic<Version *> current_{nullptr};
+  mutable std::atomic<size_type> acquiring_{0U};
+  Compare compare_;
+  // освобождать старые версии может и последний их читатель, поэтому
+  // всё, что нужно для освобождения, изменяемо в константных методах
+  mutable std::mutex write_mutex_;
+  mutable std::vector<Version *> retired_;
+  mutable NodePool<Node, Allocator> pool_;
+  std::vector<Node *> fresh_;
+};
+
+template <class K, class V, class Compare, class Allocator>
+snapshot_map<K, V, Compare, Allocator>::snapshot_map(
+    const Compare &comp, const allocator_type &alloc)
+    : compare_(comp), pool_(alloc) {
+  current_.store(new Version, std::memory_order_release);
+}
+
+template <class K, class V, class Compare, class Allocator>
+snapshot_map<K, V, Compare, Allocator>::snapshot_map(
+    std::initializer_list<value_type> const &items)
+    : snapshot_map() {
+  for (const auto &item : items) insert_or_assign(item.first, item.second);
+}
+
+template <class K, class V, class Compare, class Allocator>
+snapshot_map<K, V, Compare, Allocator>::~snapshot_map() {
+  for (Version *version : retired_) freeVersion(version);
+  freeVersion(current_.load(std::memory_order_acquire));
+}
+
+// Писатель освобождает версию, только убедившись, что её больше нет в
+// current_, acquiring_ пуст и readers равен нулю. Читатель, успевший
+// прочитать старый current_, к этому моменту уже виден в readers
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::snapshot
+snapshot_map<K, V, Compare, Allocator>::get_snapshot() const {
+  acquiring_.fetch_add(1U);
+  Version *version = current_.load();
+  version->readers.fetch_add(1U);
+  acquiring_.fetch_sub(1U);
+  return snapshot(this, version);
+}
+
+// Последний читатель списанной версии освобождает её сам, если писатель
+// сейчас не занят; иначе версию освободит следующая запись. retired
+// читается до уменьшения readers: после него версию может удалить писатель
+template <class K, class V, class Compare, class Allocator>
+snapshot_map<K, V, Compare, Allocator>::snapshot::~snapshot() {
+  if (version_ == nullptr) return;
+  bool retired = version_->retired.load();
+  if (version_->readers.fetch_sub(1U) == 1U && retired) {
+    std::unique_lock<std::mutex> lock(owner_->write_mutex_,
+                                      std::try_to_lock);
+    if (lock.owns_lock()) owner_->reclaim();
+  }
+}
+
+template <class K, class V, class Compare, class Allocator>
+const typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::findNode(const Node *node,
+                                                 const K &key) const {
+  while (node) {
+    if (compare_(key, node->data.first)) {
+      node = node->left;
+    } else if (compare_(node->data.first, key)) {
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+template <class K, class V, class Compare, class Allocator>
+const V *snapshot_map<K, V, Compare, Allocator>::snapshot::find(
+    const K &key) const {
+  if (version_ == nullptr) return nullptr;
+  const Node *node = owner_->findNode(version_->root, key);
+  return node ? &node->data.second : nullptr;
+}
+
+template <class K, class V, class Compare, class Allocator>
+const V &snapshot_map<K, V, Compare, Allocator>::snapshot::at(
+    const K &key) const {
+  const V *value = find(key);
+  if (value == nullptr) throw std::out_of_range("snapshot_map::at");
+  return *value;
+}
+
+// симметричный обход с явным стеком не глубже высоты дерева
+template <class K, class V, class Compare, class Allocator>
+template <class Fn>
+void snapshot_map<K, V, Compare, Allocator>::snapshot::for_each(
+    Fn &&fn) const {
+  if (version_ == nullptr) return;
+  std::vector<const Node *> path;
+  const Node *node = version_->root;
+  while (node || !path.empty()) {
+    for (; node; node = node->left) path.push_back(node);
+    node = path.back();
+    path.pop_back();
+    const value_type &item = node->data;
+    fn(item);
+    node = node->right;
+  }
+}
+
+template <class K, class V, class Compare, class Allocator>
+std::optional<V> snapshot_map<K, V, Compare, Allocator>::find(
+    const K &key) const {
+  snapshot view = get_snapshot();
+  const V *value = view.find(key);
+  return value ? std::optional<V>(*value) : std::nullopt;
+}
+
+template <class K, class V, class Compare, class Allocator>
+bool snapshot_map<K, V, Compare, Allocator>::insert_or_assign(
+    const K &key, const V &value) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  Version *old = current_.load();
+  bool inserted = false;
+  publish([&] {
+    Node *root = insert(old->root, key, value, inserted);
+    return std::make_pair(root, old->size + (inserted ? 1U : 0U));
+  });
+  return inserted;
+}
+
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::size_type
+snapshot_map<K, V, Compare, Allocator>::erase(const K &key) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  Version *old = current_.load();
+  if (findNode(old->root, key) == nullptr) return 0U;
+  publish([&] {
+    return std::make_pair(erase(old->root, key), old->size - 1U);
+  });
+  return 1U;
+}
+
+template <class K, class V, class Compare, class Allocator>
+void snapshot_map<K, V, Compare, Allocator>::clear() {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  publish([] { return std::make_pair(static_cast<Node *>(nullptr), 0U); });
+}
+
+// build возвращает корень и размер новой версии; она публикуется, а
+// старая списывается. Если build бросит, созданные узлы удаляются и
+// версия остаётся прежней
+template <class K, class V, class Compare, class Allocator>
+template <class Build>
+void snapshot_map<K, V, Compare, Allocator>::publish(Build build) {
+  Version *old = current_.load();
+  // на уровень пути приходится не больше трёх новых узлов
+  fresh_.reserve(3U * static_cast<size_type>(height(old->root) + 2));
+  auto version = std::make_unique<Version>();
+  try {
+    std::tie(version->root, version->size) = build();
+  } catch (...) {
+    sweepFresh();
+    throw;
+  }
+  if (version->root) ++version->root->refs;
+  sweepFresh();
+  current_.store(version.release());
+  old->retired.store(true);
+  retired_.push_back(old);
+  reclaim();
+}
+
+template <class K, class V, class Compare, class Allocator>
+void snapshot_map<K, V, Compare, Allocator>::reclaim() const noexcept {
+  if (acquiring_.load() != 0U) return;
+  auto alive = std::remove_if(
+      retired_.begin(), retired_.end(), [this](Version *version) {
+        if (version->readers.load() != 0U) return false;
+        freeVersion(version);
+        return true;
+      });
+  retired_.erase(alive, retired_.end());
+}
+
+template <class K, class V, class Compare, class Allocator>
+void snapshot_map<K, V, Compare, Allocator>::freeVersion(
+    Version *version) const noexcept {
+  release(version->root);
+  delete version;
+}
+
+// узел, на который больше никто не ссылается, уносит с собой ссылки на
+// детей; рекурсия не глубже высоты дерева
+template <class K, class V, class Compare, class Allocator>
+void snapshot_map<K, V, Compare, Allocator>::release(
+    Node *node) const noexcept {
+  if (node == nullptr || --node->refs != 0U) return;
+  release(node->left);
+  release(node->right);
+  pool_.destroy(node);
+}
+
+template <class K, class V, class Compare, class Allocator>
+template <class... Args>
+typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::make(Node *left, Node *right,
+                                             Args &&...args) {
+  Node *node = pool_.create(left, right, std::forward<Args>(args)...);
+  fresh_.push_back(node);
+  if (left) ++left->refs;
+  if (right) ++right->refs;
+  node->height = 1 + std::max(height(left), height(right));
+  return node;
+}
+
+// Новые узлы, на которые не сослался ни один другой: промежуточные
+// результаты поворотов или всё построенное, если build бросил. Дети
+// создаются раньше родителей, поэтому обход с конца видит у узла
+// окончательное число ссылок
+template <class K, class V, class Compare, class Allocator>
+void snapshot_map<K, V, Compare, Allocator>::sweepFresh() noexcept {
+  for (auto it = fresh_.rbegin(); it != fresh_.rend(); ++it) {
+    Node *node = *it;
+    if (node->refs != 0U) continue;
+    if (node->left) --node->left->refs;
+    if (node->right) --node->right->refs;
+    pool_.destroy(node);
+  }
+  fresh_.clear();
+}
+
+// новый узел с data между left и right; высоты поддеревьев отличаются
+// не больше чем на два, после поворота дерево снова AVL
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::balance(Node *left,
+                                                const value_type &data,
+                                                Node *right) {
+  if (height(left) > height(right) + 1) {
+    if (height(left->left) >= height(left->right))
+      return make(left->left, make(left->right, right, data), left->data);
+    Node *mid = left->right;
+    return make(make(left->left, mid->left, left->data),
+                make(mid->right, right, data), mid->data);
+  }
+  if (height(right) > height(left) + 1) {
+    if (height(right->right) >= height(right->left))
+      return make(make(left, right->left, data), right->right, right->data);
+    Node *mid = right->left;
+    return make(make(left, mid->left, data),
+                make(mid->right, right->right, right->data), mid->data);
+  }
+  return make(left, right, data);
+}
+
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::insert(Node *node, const K &key,
+                                               const V &value,
+                                               bool &inserted) {
+  if (node == nullptr) {
+    inserted = true;
+    return make(nullptr, nullptr, key, value);
+  }
+  if (compare_(key, node->data.first))
+    return balance(insert(node->left, key, value, inserted), node->data,
+                   node->right);
+  if (compare_(node->data.first, key))
+    return balance(node->left, node->data,
+                   insert(node->right, key, value, inserted));
+  return make(node->left, node->right, key, value);
+}
+
+// ключ точно есть в поддереве: erase проверяет это до публикации
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::erase(Node *node, const K &key) {
+  if (compare_(key, node->data.first))
+    return balance(erase(node->left, key), node->data, node->right);
+  if (compare_(node->data.first, key))
+    return balance(node->left, node->data, erase(node->right, key));
+  if (node->left == nullptr) return node->right;
+  if (node->right == nullptr) return node->left;
+  const value_type *min = nullptr;
+  Node *right = eraseMin(node->right, min);
+  return balance(node->left, *min, right);
+}
+
+// min - пара из наименьшего узла; он остаётся в старой версии
+template <class K, class V, class Compare, class Allocator>
+typename snapshot_map<K, V, Compare, Allocator>::Node *
+snapshot_map<K, V, Compare, Allocator>::eraseMin(Node *node,
+                                                 const value_type *&min) {
+  if (node->left == nullptr) {
+    min = &node->data;
+    return node->right;
+  }
+  return balance(eraseMin(node->left, min), node->data, node->right);
+}
+
+}  // namespace s21
+
+#endif  // S21_SNAPSHOT_MAP_H
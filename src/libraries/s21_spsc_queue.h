@@ -0,0 +1,153 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Ограниченная очередь для одного производителя и одного потребителя:
+// кольцевой буфер на Capacity элементов без блокировок и без выделения
+// памяти. Индексы только растут, слот - индекс по модулю Capacity.
+// Производитель пишет tail_, потребитель - head_; каждый держит копию
+// чужого индекса и перечитывает её, только когда буфер кажется полным
+// или пустым
+template <class T, std::size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity > 0U && (Capacity & (Capacity - 1U)) == 0U,
+                "SpscQueue: Capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  SpscQueue() = default;
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+  ~SpscQueue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+      slot(i)->~T();
+  }
+
+  static constexpr size_type capacity() noexcept { return Capacity; }
+  // у потока, который не владеет индексом, значение может устареть
+  [[nodiscard]] size_type size() const noexcept {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+
+  // вызывается только производителем; false - буфер полон
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+  // кладёт до count элементов из first и публикует их одной записью
+  // tail_; возвращает, сколько поместилось
+  template <class InputIt>
+  size_type push_n(InputIt first, size_type count);
+
+  // вызывается только потребителем; false - очередь пуста
+  bool try_pop(reference out);
+  // переносит в out до count элементов и освобождает их слоты разом
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type count);
+
+ private:
+  static constexpr size_type kMask = Capacity - 1U;
+
+  value_type *slot(size_type index) noexcept {
+    return reinterpret_cast<value_type *>(slots_[index & kMask].bytes);
+  }
+  // свободные слоты с точки зрения производителя
+  size_type freeSlots(size_type tail, size_type wanted) {
+    if (Capacity - (tail - head_cache_) < wanted)
+      head_cache_ = head_.load(std::memory_order_acquire);
+    return Capacity - (tail - head_cache_);
+  }
+  // готовые элементы с точки зрения потребителя
+  size_type readySlots(size_type head, size_type wanted) {
+    if (tail_cache_ - head < wanted)
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+    return tail_cache_ - head;
+  }
+
+  struct Slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+  };
+
+  alignas(kCacheLine) std::atomic<size_type> tail_{0U};
+  size_type head_cache_{0U};
+  alignas(kCacheLine) std::atomic<size_type> head_{0U};
+  size_type tail_cache_{0U};
+  alignas(kCacheLine) Slot slots_[Capacity];
+};
+
+template <class T, std::size_t Capacity>
+template <class... Args>
+bool SpscQueue<T, Capacity>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (freeSlots(tail, 1U) == 0U) return false;
+  ::new (static_cast<void *>(slot(tail))) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1U, std::memory_order_release);
+  return true;
+}
+
+// если конструктор бросит, уже построенные элементы всё равно публикуются
+template <class T, std::size_t Capacity>
+template <class InputIt>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::push_n(
+    InputIt first, size_type count) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type free = freeSlots(tail, count);
+  if (count > free) count = free;
+  size_type built = 0U;
+  try {
+    for (; built < count; ++built, ++first)
+      ::new (static_cast<void *>(slot(tail + built))) T(*first);
+  } catch (...) {
+    tail_.store(tail + built, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <class T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::try_pop(reference out) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (readySlots(head, 1U) == 0U) return false;
+  value_type *item = slot(head);
+  out = std::move(*item);
+  item->~T();
+  head_.store(head + 1U, std::memory_order_release);
+  return true;
+}
+
+template <class T, std::size_t Capacity>
+template <class OutputIt>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::pop_n(
+    OutputIt out, size_type count) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type ready = readySlots(head, count);
+  if (count > ready) count = ready;
+  for (size_type i = 0U; i < count; ++i, ++out) {
+    value_type *item = slot(head + i);
+    *out = std::move(*item);
+    item->~T();
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+}  // namespace s21
+
+#endif  // S21_SPSC_QUEUE_H
@@ -23,6 +23,7 @@ class Stack {
   bool empty() { return cont.empty(); }
 
   void push(const_reference value) { cont.push_back(value); }
+  void push(value_type &&value) { cont.push_back(std::move(value)); }
   void pop() { cont.pop_back(); }
   void swap(Stack &other) { std::swap(cont, other.cont); }
   template <class... Args>
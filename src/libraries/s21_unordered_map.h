@@ -0,0 +1,162 @@
+#ifndef S21_UNORDERED_MAP_H
+#define S21_UNORDERED_MAP_H
+
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+
+#include "hash_table.h"
+#include "key_of.h"
+
+namespace s21 {
+
+template <class K, class T, class Hash = std::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class unordered_map
+    : public HashTable<K, std::pair<const K, T>, PairKey<K, T>, Hash,
+                       KeyEqual, Allocator> {
+ public:
+  using HT = HashTable<K, std::pair<const K, T>, PairKey<K, T>, Hash,
+                       KeyEqual, Allocator>;
+  using allocator_type = Allocator;
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const K, T>;
+  using size_type = std::size_t;
+  using iterator = typename HT::iterator;
+  using const_iterator = typename HT::const_iterator;
+  using insert_result = std::pair<iterator, bool>;
+
+  unordered_map() = default;
+  explicit unordered_map(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual(),
+                         const allocator_type &alloc = allocator_type())
+      : HT(bucket_count, hash, equal, alloc) {}
+  explicit unordered_map(const allocator_type &alloc) : HT(alloc) {}
+  unordered_map(std::initializer_list<value_type> const &items);
+  unordered_map(const unordered_map &other) = default;
+  unordered_map(unordered_map &&other) noexcept = default;
+  ~unordered_map() = default;
+
+  unordered_map &operator=(unordered_map &&other) noexcept = default;
+
+  T &at(const K &key);
+  const T &at(const K &key) const;
+  T &operator[](const K &key);
+
+  insert_result insert(const value_type &value);
+  insert_result insert(const K &key, const T &value);
+  insert_result insert_or_assign(const K &key, const T &value);
+  template <class... Args>
+  insert_result emplace(Args &&...args);
+  iterator erase(const_iterator pos);
+  size_type erase(const K &key);
+  void swap(unordered_map &other) noexcept { HT::swapTable(other); }
+  void merge(unordered_map &other);
+
+  iterator find(const K &key) { return HT::findIterator(key); }
+  const_iterator find(const K &key) const { return HT::findIterator(key); }
+  bool contains(const K &key) const {
+    return HT::findIndex(key) != HT::kNotFound;
+  }
+  size_type count(const K &key) const { return contains(key) ? 1U : 0U; }
+};
+
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+unordered_map<K, T, Hash, KeyEqual, Allocator>::unordered_map(
+    std::initializer_list<value_type> const &items) {
+  HT::reserve(items.size());
+  for (const auto &item : items) insert(item);
+}
+
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+T &unordered_map<K, T, Hash, KeyEqual, Allocator>::at(const K &key) {
+  size_type i = HT::findIndex(key);
+  if (i == HT::kNotFound) throw std::out_of_range("unordered_map::at");
+  return HT::iteratorAt(i)->second;
+}
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+const T &unordered_map<K, T, Hash, KeyEqual, Allocator>::at(
+    const K &key) const {
+  size_type i = HT::findIndex(key);
+  if (i == HT::kNotFound) throw std::out_of_range("unordered_map::at");
+  return HT::iteratorAt(i)->second;
+}
+// один поиск: значение по умолчанию строится, только если ключа нет
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+T &unordered_map<K, T, Hash, KeyEqual, Allocator>::operator[](const K &key) {
+  auto result = HT::insertUnique(key, std::piecewise_construct,
+                                 std::forward_as_tuple(key), std::tuple<>());
+  return HT::iteratorAt(result.first)->second;
+}
+
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::insert_result
+unordered_map<K, T, Hash, KeyEqual, Allocator>::insert(
+    const value_type &value) {
+  auto result = HT::insertUnique(value.first, value);
+  return {HT::iteratorAt(result.first), result.second};
+}
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::insert_result
+unordered_map<K, T, Hash, KeyEqual, Allocator>::insert(const K &key,
+                                                        const T &value) {
+  auto result = HT::insertUnique(key, key, value);
+  return {HT::iteratorAt(result.first), result.second};
+}
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::insert_result
+unordered_map<K, T, Hash, KeyEqual, Allocator>::insert_or_assign(
+    const K &key, const T &value) {
+  auto result = HT::insertUnique(key, key, value);
+  iterator it = HT::iteratorAt(result.first);
+  if (!result.second) it->second = value;
+  return {it, result.second};
+}
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+template <class... Args>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::insert_result
+unordered_map<K, T, Hash, KeyEqual, Allocator>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  auto result = HT::insertUnique(value.first, std::move(value));
+  return {HT::iteratorAt(result.first), result.second};
+}
+
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::iterator
+unordered_map<K, T, Hash, KeyEqual, Allocator>::erase(const_iterator pos) {
+  size_type i = HT::indexOf(pos);
+  iterator next = HT::iteratorAt(i);
+  ++next;
+  HT::eraseAt(i);
+  return next;
+}
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+typename unordered_map<K, T, Hash, KeyEqual, Allocator>::size_type
+unordered_map<K, T, Hash, KeyEqual, Allocator>::erase(const K &key) {
+  size_type i = HT::findIndex(key);
+  if (i == HT::kNotFound) return 0U;
+  HT::eraseAt(i);
+  return 1U;
+}
+
+// переносит элементы, ключей которых ещё нет; остальные остаются в other.
+// Удаление из other не двигает его слоты, поэтому обход не сбивается
+template <class K, class T, class Hash, class KeyEqual, class Allocator>
+void unordered_map<K, T, Hash, KeyEqual, Allocator>::merge(
+    unordered_map &other) {
+  if (&other == this) return;
+  for (auto it = other.begin(); it != other.end();) {
+    auto result = HT::insertUnique(it->first, std::move(*it));
+    if (result.second) {
+      it = other.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MAP_H
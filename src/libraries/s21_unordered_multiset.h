@@ -0,0 +1,258 @@
+#ifndef S21_UNORDERED_MULTISET_H
+#define S21_UNORDERED_MULTISET_H
+
+#include <initializer_list>
+#include <iterator>
+
+#include "hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Слот мультимножества: первый экземпляр ключа лежит прямо в слоте,
+// равные ему - в Vector, который выделяет память только при повторах.
+// Так равные элементы идут подряд и equal_range - это один слот.
+template <class Key, class Allocator>
+struct EqualKeys {
+  EqualKeys(const Key &key, const Allocator &alloc) : first(key), rest(alloc) {}
+  EqualKeys(Key &&key, const Allocator &alloc)
+      : first(std::move(key)), rest(alloc) {}
+
+  std::size_t count() const { return rest.size() + 1U; }
+
+  Key first;
+  Vector<Key, Allocator> rest;
+};
+
+template <class Key, class Allocator>
+struct EqualKeysKey {
+  const Key &operator()(const EqualKeys<Key, Allocator> &value) const {
+    return value.first;
+  }
+};
+
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class unordered_multiset
+    : public HashTable<Key, EqualKeys<Key, Allocator>,
+                       EqualKeysKey<Key, Allocator>, Hash, KeyEqual,
+                       Allocator> {
+ public:
+  using HT = HashTable<Key, EqualKeys<Key, Allocator>,
+                       EqualKeysKey<Key, Allocator>, Hash, KeyEqual, Allocator>;
+  using allocator_type = Allocator;
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+
+  class MultiIterator;
+  using iterator = MultiIterator;
+  using const_iterator = MultiIterator;
+  using pairiterator = std::pair<iterator, iterator>;
+
+  unordered_multiset() = default;
+  explicit unordered_multiset(size_type bucket_count, const Hash &hash = Hash(),
+                              const KeyEqual &equal = KeyEqual(),
+                              const allocator_type &alloc = allocator_type())
+      : HT(bucket_count, hash, equal, alloc) {}
+  explicit unordered_multiset(const allocator_type &alloc) : HT(alloc) {}
+  unordered_multiset(std::initializer_list<value_type> const &items);
+  unordered_multiset(const unordered_multiset &other) = default;
+  unordered_multiset(unordered_multiset &&other) noexcept
+      : HT(std::move(other)) {
+    std::swap(total_, other.total_);
+  }
+  ~unordered_multiset() = default;
+
+  unordered_multiset &operator=(unordered_multiset &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  iterator begin() const noexcept { return iterator(HT::begin(), 0U); }
+  iterator end() const noexcept { return iterator(HT::end(), 0U); }
+
+  // HT::size() считает различные ключи, здесь - все элементы
+  size_type size() const noexcept { return total_; }
+  void clear() noexcept {
+    HT::clear();
+    total_ = 0U;
+  }
+
+  iterator insert(const value_type &value) { return insertValue(value); }
+  template <class... Args>
+  iterator emplace(Args &&...args) {
+    return insertValue(value_type(std::forward<Args>(args)...));
+  }
+  iterator erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(unordered_multiset &other) noexcept {
+    HT::swapTable(other);
+    std::swap(total_, other.total_);
+  }
+  void merge(unordered_multiset &other);
+
+  iterator find(const Key &key) const {
+    return iterator(HT::findIterator(key), 0U);
+  }
+  bool contains(const Key &key) const {
+    return HT::findIndex(key) != HT::kNotFound;
+  }
+  size_type count(const Key &key) const;
+  pairiterator equal_range(const Key &key) const;
+
+ private:
+  template <class V>
+  iterator insertValue(V &&value);
+
+  size_type total_{};
+};
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+class unordered_multiset<Key, Hash, KeyEqual, Allocator>::MultiIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Key *;
+  using reference = const Key &;
+  using slot_iterator = typename HT::const_iterator;
+
+  MultiIterator() = default;
+  MultiIterator(slot_iterator slot, size_type index)
+      : slot_(slot), index_(index) {}
+
+  reference operator*() const {
+    return index_ ? slot_->rest[index_ - 1U] : slot_->first;
+  }
+  pointer operator->() const { return &**this; }
+
+  MultiIterator &operator++() {
+    if (index_ < slot_->rest.size()) {
+      ++index_;
+    } else {
+      ++slot_;
+      index_ = 0U;
+    }
+    return *this;
+  }
+  MultiIterator operator++(int) {
+    MultiIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  bool operator==(const MultiIterator &other) const {
+    return slot_ == other.slot_ && index_ == other.index_;
+  }
+  bool operator!=(const MultiIterator &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class unordered_multiset;
+  slot_iterator slot_{};
+  size_type index_{};
+};
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::unordered_multiset(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) insert(item);
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+template <class V>
+typename unordered_multiset<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::insertValue(V &&value) {
+  size_type hash = HT::hashKey(value);
+  size_type i = HT::findIndex(value, hash);
+  if (i == HT::kNotFound) {
+    i = HT::insertNew(hash, std::forward<V>(value), HT::get_allocator());
+    ++total_;
+    return iterator(HT::iteratorAt(i), 0U);
+  }
+  auto slot = HT::iteratorAt(i);
+  slot->rest.push_back(std::forward<V>(value));
+  ++total_;
+  return iterator(slot, slot->count() - 1U);
+}
+
+// возвращает следующий элемент; равные ключи после удаления не
+// переставляются
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_multiset<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::erase(const_iterator pos) {
+  size_type i = HT::indexOf(pos.slot_);
+  auto slot = HT::iteratorAt(i);
+  --total_;
+  if (slot->rest.empty()) {
+    auto next = pos.slot_;
+    ++next;
+    HT::eraseAt(i);
+    return iterator(next, 0U);
+  }
+  if (pos.index_ == 0U) {
+    slot->first = std::move(slot->rest[0]);
+    slot->rest.erase(slot->rest.begin());
+  } else {
+    slot->rest.erase(slot->rest.begin() + (pos.index_ - 1U));
+  }
+  if (pos.index_ < slot->count()) return pos;
+  auto next = pos.slot_;
+  return iterator(++next, 0U);
+}
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_multiset<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::erase(const Key &key) {
+  size_type i = HT::findIndex(key);
+  if (i == HT::kNotFound) return 0U;
+  size_type removed = HT::iteratorAt(i)->count();
+  HT::eraseAt(i);
+  total_ -= removed;
+  return removed;
+}
+
+// забирает все элементы other; ключ, которого здесь нет, переезжает
+// вместе со всеми своими повторами одним слотом
+template <class Key, class Hash, class KeyEqual, class Allocator>
+void unordered_multiset<Key, Hash, KeyEqual, Allocator>::merge(
+    unordered_multiset &other) {
+  if (&other == this) return;
+  HT::reserve(HT::size() + other.HT::size());
+  for (auto it = other.HT::begin(); it != other.HT::end(); ++it) {
+    size_type hash = HT::hashKey(it->first);
+    size_type i = HT::findIndex(it->first, hash);
+    if (i == HT::kNotFound) {
+      HT::insertNew(hash, std::move(*it));
+      continue;
+    }
+    auto &target = *HT::iteratorAt(i);
+    target.rest.push_back(std::move(it->first));
+    for (auto &key : it->rest) target.rest.push_back(std::move(key));
+  }
+  total_ += other.total_;
+  other.clear();
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_multiset<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::count(
+    const Key &key) const {
+  size_type i = HT::findIndex(key);
+  return i == HT::kNotFound ? 0U : HT::iteratorAt(i)->count();
+}
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_multiset<Key, Hash, KeyEqual, Allocator>::pairiterator
+unordered_multiset<Key, Hash, KeyEqual, Allocator>::equal_range(
+    const Key &key) const {
+  auto slot = HT::findIterator(key);
+  if (slot == HT::end()) return {end(), end()};
+  auto next = slot;
+  return {iterator(slot, 0U), iterator(++next, 0U)};
+}
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MULTISET_H
@@ -0,0 +1,126 @@
+#ifndef S21_UNORDERED_SET_H
+#define S21_UNORDERED_SET_H
+
+#include <initializer_list>
+
+#include "hash_table.h"
+#include "key_of.h"
+
+namespace s21 {
+
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class unordered_set
+    : public HashTable<Key, Key, IdentityKey<Key>, Hash, KeyEqual, Allocator> {
+ public:
+  using HT = HashTable<Key, Key, IdentityKey<Key>, Hash, KeyEqual, Allocator>;
+  using allocator_type = Allocator;
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  // ключи менять нельзя: изменился бы их хеш
+  using iterator = typename HT::const_iterator;
+  using const_iterator = typename HT::const_iterator;
+  using insert_result = std::pair<iterator, bool>;
+
+  unordered_set() = default;
+  explicit unordered_set(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual(),
+                         const allocator_type &alloc = allocator_type())
+      : HT(bucket_count, hash, equal, alloc) {}
+  explicit unordered_set(const allocator_type &alloc) : HT(alloc) {}
+  unordered_set(std::initializer_list<value_type> const &items);
+  unordered_set(const unordered_set &other) = default;
+  unordered_set(unordered_set &&other) noexcept = default;
+  ~unordered_set() = default;
+
+  unordered_set &operator=(unordered_set &&other) noexcept = default;
+
+  iterator begin() const noexcept { return HT::begin(); }
+  iterator end() const noexcept { return HT::end(); }
+
+  insert_result insert(const value_type &value);
+  template <class... Args>
+  insert_result emplace(Args &&...args);
+  iterator erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(unordered_set &other) noexcept { HT::swapTable(other); }
+  void merge(unordered_set &other);
+
+  iterator find(const Key &key) const { return HT::findIterator(key); }
+  bool contains(const Key &key) const {
+    return HT::findIndex(key) != HT::kNotFound;
+  }
+  size_type count(const Key &key) const { return contains(key) ? 1U : 0U; }
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+};
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(
+    std::initializer_list<value_type> const &items) {
+  HT::reserve(items.size());
+  for (const auto &item : items) insert(item);
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::insert_result
+unordered_set<Key, Hash, KeyEqual, Allocator>::insert(
+    const value_type &value) {
+  auto result = HT::insertUnique(value, value);
+  return {HT::iteratorAt(result.first), result.second};
+}
+template <class Key, class Hash, class KeyEqual, class Allocator>
+template <class... Args>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::insert_result
+unordered_set<Key, Hash, KeyEqual, Allocator>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  auto result = HT::insertUnique(value, std::move(value));
+  return {HT::iteratorAt(result.first), result.second};
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator
+unordered_set<Key, Hash, KeyEqual, Allocator>::erase(const_iterator pos) {
+  iterator next = pos;
+  ++next;
+  HT::eraseAt(HT::indexOf(pos));
+  return next;
+}
+template <class Key, class Hash, class KeyEqual, class Allocator>
+typename unordered_set<Key, Hash, KeyEqual, Allocator>::size_type
+unordered_set<Key, Hash, KeyEqual, Allocator>::erase(const Key &key) {
+  size_type i = HT::findIndex(key);
+  if (i == HT::kNotFound) return 0U;
+  HT::eraseAt(i);
+  return 1U;
+}
+
+// ключи, которые уже есть в *this, остаются в other
+template <class Key, class Hash, class KeyEqual, class Allocator>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::merge(
+    unordered_set &other) {
+  if (&other == this) return;
+  for (auto it = other.begin(); it != other.end();) {
+    if (HT::insertUnique(*it, *it).second) {
+      it = other.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator,
+          typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::equal_range(
+    const Key &key) const {
+  iterator first = find(key);
+  if (first == end()) return {first, first};
+  iterator last = first;
+  return {first, ++last};
+}
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H
@@ -1,11 +1,23 @@
+#ifndef S21_VECTOR_H
+#define S21_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class Vector {
  public:
   // member types
+  using allocator_type = Allocator;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -13,54 +25,78 @@ class Vector {
   using const_iterator = const T *;
   using size_type = size_t;
 
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  template <class A, class = void>
+  struct hasConstruct : std::false_type {};
+  template <class A>
+  struct hasConstruct<A, std::void_t<decltype(std::declval<A &>().construct(
+                             std::declval<value_type *>(),
+                             std::declval<const value_type &>()))>>
+      : std::true_type {};
+  // элементы можно переносить memcpy/memmove, если тип тривиально
+  // копируется и аллокатор не подменяет конструирование
+  static constexpr bool kTrivial =
+      std::is_trivially_copyable<value_type>::value &&
+      (std::is_same<allocator_type, std::allocator<value_type>>::value ||
+       !hasConstruct<allocator_type>::value);
+
+ public:
   // constructors
   Vector() : m_size(0U), m_capacity(0U), arr(nullptr){};
+  explicit Vector(const allocator_type &alloc)
+      : m_size(0U), m_capacity(0U), arr(nullptr), alloc_(alloc){};
 
-  explicit Vector(size_type n)
-      : m_size(n), m_capacity(n), arr(n ? new T[n] : nullptr){};
+  explicit Vector(size_type n, const allocator_type &alloc = allocator_type())
+      : m_size(0U), m_capacity(0U), arr(nullptr), alloc_(alloc) {
+    resize(n);
+  };
 
-  Vector(std::initializer_list<value_type> const &items) {
-    arr = new value_type[items.size()];
-    size_type i = 0;
-    for (auto it = items.begin(); it != items.end(); it++) {
-      arr[i] = *it;
-      i++;
-    }
-    m_size = items.size();
-    m_capacity = items.size();
+  Vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type())
+      : m_size(0U), m_capacity(0U), arr(nullptr), alloc_(alloc) {
+    assign(items.begin(), items.end(), items.size());
   };
 
   // copy constructor with simplified syntax
-  Vector(const Vector &v) : m_size(v.m_size), m_capacity(v.m_capacity) {
-    arr = new value_type[m_capacity];
-    for (size_type i = 0; i < v.m_size; ++i) {
-      arr[i] = v.arr[i];
-    }
+  Vector(const Vector &v)
+      : m_size(0U),
+        m_capacity(0U),
+        arr(nullptr),
+        alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    assign(v.arr, v.arr + v.m_size, v.m_size);
   };
 
   // move constructor with simplified syntax
-  Vector(Vector &&v) : m_size(v.m_size), m_capacity(v.m_capacity), arr(v.arr) {
+  Vector(Vector &&v) noexcept
+      : m_size(v.m_size),
+        m_capacity(v.m_capacity),
+        arr(v.arr),
+        alloc_(std::move(v.alloc_)) {
     v.arr = nullptr;
     v.m_size = 0;
     v.m_capacity = 0;
   };
 
   // destructor
-  ~Vector() { delete[] arr; }
+  ~Vector() {
+    destroy(arr, arr + m_size);
+    deallocate(arr, m_capacity);
+  }
 
   Vector &operator=(Vector &&v) {
-    m_size = v.m_size;
-    m_capacity >= v.m_capacity ? m_capacity : m_capacity = v.m_capacity;
-    arr = v.arr;
-    v.arr = nullptr;
-    v.m_size = v.m_capacity = 0;
+    swap(v);
     return *this;
   };
 
+  allocator_type get_allocator() const { return alloc_; }
+
   // Vector Element access
   reference at(size_type pos) { return arr[pos]; }  // pos > size
 
   reference operator[](size_type pos) { return arr[pos]; }
+  const_reference operator[](size_type pos) const { return arr[pos]; }
 
   const_reference front() { return arr[0]; }
 
@@ -71,83 +107,121 @@ class Vector {
   // Vector Iterators
   iterator begin() noexcept { return arr; }
   iterator end() noexcept { return arr + m_size; }
+  const_iterator begin() const noexcept { return arr; }
+  const_iterator end() const noexcept { return arr + m_size; }
 
   // Vector Capacity
-  bool empty() { return m_size ? false : true; }
-  size_type size() { return m_size; }
+  bool empty() const { return m_size ? false : true; }
+  size_type size() const { return m_size; }
   size_type max_size() {
     return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2U;
   }
 
   void reserve(size_t size) {
-    if (size > m_capacity) {
-      value_type *buff = new value_type[size];
-      for (size_t i = 0; i < m_size; ++i) buff[i] = std::move(arr[i]);
-      delete[] arr;
-      arr = buff;
-      m_capacity = size;
-    }
+    if (size > m_capacity) reallocate(size);
   }
   size_type capacity() { return m_capacity; }
 
   void shrink_to_fit() {
-    if (m_size < m_capacity) {
-      value_type *buff = new value_type[m_size];
-      for (size_t i = 0; i < m_size; ++i) buff[i] = std::move(arr[i]);
-      delete[] arr;
-      arr = buff;
-      m_capacity = m_size;
-    }
+    if (m_size < m_capacity) reallocate(m_size);
   }
 
   // Vector Modifiers
   void clear() {
-    arr = nullptr;
+    destroy(arr, arr + m_size);
     m_size = 0;
   }
   iterator insert(iterator pos, const_reference value) {  // 5 5
-    value_type *buff = new value_type[m_size + 1];
-
-    size_t position = pos - begin();
+    return insert(pos, 1U, value);
+  }
+  iterator insert(iterator pos, size_type count, const_reference value) {
+    // копия нужна, если value ссылается на элемент самого вектора
+    value_type copy(value);
+    return insertWith(pos - begin(), count, [&](value_type *dest) {
+      alloc_traits::construct(alloc_, dest, copy);
+    });
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    // value тоже может лежать в самом векторе
+    value_type moved(std::move(value));
+    return insertWith(pos - begin(), 1U, [&](value_type *dest) {
+      alloc_traits::construct(alloc_, dest, std::move(moved));
+    });
+  }
+  template <class InputIt, class Category = typename std::iterator_traits<
+                               InputIt>::iterator_category>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  Category>::value) {
+      size_type count = std::distance(first, last);
+      return insertWith(pos - begin(), count, [&](value_type *dest) {
+        alloc_traits::construct(alloc_, dest, *first);
+        ++first;
+      });
+    } else {
+      // однопроходный диапазон нельзя сосчитать заранее: он копится во
+      // временном векторе и переносится оттуда
+      Vector buffer(alloc_);
+      for (; first != last; ++first) buffer.emplace_back(*first);
+      return insert(pos, std::make_move_iterator(buffer.begin()),
+                    std::make_move_iterator(buffer.end()));
+    }
+  }
 
-    for (size_t i = 0; i < m_size + 1; ++i) {
-      if (i < position) {
-        buff[i] = arr[i];
-      } else if (i == position) {
-        buff[i] = value;
-        buff[i + 1] = arr[i];
+  iterator erase(iterator pos) { return erase(pos, pos + 1); }
+  iterator erase(iterator first, iterator last) {
+    if (first != last) {
+      iterator new_end = first + (end() - last);
+      if constexpr (kTrivial) {
+        std::memmove(first, last, (end() - last) * sizeof(value_type));
       } else {
-        buff[i + 1] = arr[i];
+        std::move(last, end(), first);
+        destroy(new_end, end());
       }
+      m_size = new_end - arr;
     }
-    reserve(m_size * 2);
-    m_size++;
-    arr = buff;
-    return (arr + position);
+    return first;
   }
 
-  void erase(iterator pos) {
-    value_type *buff = new value_type[m_size - 1];
+  void push_back(const_reference v) { emplace_back(v); }
+  void push_back(value_type &&v) { emplace_back(std::move(v)); }
 
-    size_t position = pos - begin();
-
-    for (size_t i = 0; i < m_size + 1; ++i) {
-      if (i < position) {
-        buff[i] = arr[i];
-      } else if (i > position) {
-        buff[i - 1] = arr[i];
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (m_size == m_capacity) {
+      // новый элемент строится до переноса: args могут ссылаться на arr
+      size_type new_capacity = growth();
+      value_type *buff = allocate(new_capacity);
+      try {
+        alloc_traits::construct(alloc_, buff + m_size,
+                                std::forward<Args>(args)...);
+        try {
+          constructMove(arr, arr + m_size, buff);
+        } catch (...) {
+          alloc_traits::destroy(alloc_, buff + m_size);
+          throw;
+        }
+      } catch (...) {
+        deallocate(buff, new_capacity);
+        throw;
       }
+      destroy(arr, arr + m_size);
+      deallocate(arr, m_capacity);
+      arr = buff;
+      m_capacity = new_capacity;
+    } else {
+      alloc_traits::construct(alloc_, arr + m_size,
+                              std::forward<Args>(args)...);
     }
-    m_size--;
-    arr = buff;
+    return arr[m_size++];
   }
 
-  void push_back(value_type v) {
-    if (m_size == m_capacity) reserve(m_size * 2);
-    arr[m_size++] = v;
-  }
+  void pop_back() { alloc_traits::destroy(alloc_, arr + --m_size); }
 
-  void pop_back() { erase(end() - 1); }
+  void resize(size_type count) { resizeWith(count); }
+  void resize(size_type count, const_reference value) {
+    resizeWith(count, value);
+  }
 
   void swap(Vector &other) {
     value_type *buff = other.arr;
@@ -159,10 +233,166 @@ class Vector {
     size_type buff_capacity = other.m_capacity;
     other.m_capacity = m_capacity;
     m_capacity = buff_capacity;
+    std::swap(alloc_, other.alloc_);
   }
 
  private:
+  // память выделяется без конструирования: живы только элементы [0, size)
+  value_type *allocate(size_type n) {
+    return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+  }
+  void deallocate(value_type *buff, size_type n) {
+    if (buff) alloc_traits::deallocate(alloc_, buff, n);
+  }
+  void destroy(value_type *first, value_type *last) {
+    if constexpr (!kTrivial) {
+      for (; first != last; ++first) alloc_traits::destroy(alloc_, first);
+    }
+  }
+  size_type growth() const { return m_capacity ? m_capacity * 2U : 1U; }
+
+  template <class InputIt>
+  void constructCopy(InputIt first, InputIt last, value_type *dest) {
+    if constexpr (kTrivial && std::is_pointer<InputIt>::value) {
+      if (first != last)
+        std::memcpy(dest, first, (last - first) * sizeof(value_type));
+      return;
+    }
+    value_type *cur = dest;
+    try {
+      for (; first != last; ++first, ++cur)
+        alloc_traits::construct(alloc_, cur, *first);
+    } catch (...) {
+      destroy(dest, cur);
+      throw;
+    }
+  }
+  // перенос в неинициализированную память; копирует, если move может бросить.
+  // Диапазоны не перекрываются
+  void constructMove(value_type *first, value_type *last, value_type *dest) {
+    if constexpr (kTrivial) {
+      if (first != last)
+        std::memcpy(dest, first, (last - first) * sizeof(value_type));
+      return;
+    }
+    value_type *cur = dest;
+    try {
+      for (; first != last; ++first, ++cur)
+        alloc_traits::construct(alloc_, cur, std::move_if_noexcept(*first));
+    } catch (...) {
+      destroy(dest, cur);
+      throw;
+    }
+  }
+
+  // вставляет count элементов, которые строит construct, начиная с position.
+  // Если места хватает, хвост сдвигается внутри текущего буфера один раз
+  // на всю пачку; иначе элементы переносятся в новый буфер.
+  template <class Construct>
+  iterator insertWith(size_type position, size_type count,
+                      Construct construct) {
+    if (count == 0) return arr + position;
+    if (m_size + count > m_capacity) {
+      size_type new_capacity = std::max(m_size + count, growth());
+      value_type *buff = allocate(new_capacity);
+      size_type built = 0;
+      try {
+        for (; built < count; ++built) construct(buff + position + built);
+        constructMove(arr, arr + position, buff);
+        try {
+          constructMove(arr + position, arr + m_size, buff + position + count);
+        } catch (...) {
+          destroy(buff, buff + position);
+          throw;
+        }
+      } catch (...) {
+        destroy(buff + position, buff + position + built);
+        deallocate(buff, new_capacity);
+        throw;
+      }
+      destroy(arr, arr + m_size);
+      deallocate(arr, m_capacity);
+      arr = buff;
+      m_capacity = new_capacity;
+    } else {
+      openGap(position, count);
+      size_type built = 0;
+      try {
+        for (; built < count; ++built) construct(arr + position + built);
+      } catch (...) {
+        // базовая гарантия: вектор обрезается до позиции вставки
+        destroy(arr + position, arr + position + built);
+        destroy(arr + position + count, arr + m_size + count);
+        m_size = position;
+        throw;
+      }
+    }
+    m_size += count;
+    return arr + position;
+  }
+  // сдвигает [position, size) на count вправо, оставляя на месте сдвига
+  // неинициализированную память; требует m_size + count <= m_capacity
+  void openGap(size_type position, size_type count) {
+    value_type *pos = arr + position;
+    value_type *old_end = arr + m_size;
+    if constexpr (kTrivial) {
+      std::memmove(pos + count, pos, (old_end - pos) * sizeof(value_type));
+    } else if (m_size - position > count) {
+      constructMove(old_end - count, old_end, old_end);
+      std::move_backward(pos, old_end - count, old_end);
+      destroy(pos, pos + count);
+    } else {
+      constructMove(pos, old_end, pos + count);
+      destroy(pos, old_end);
+    }
+  }
+
+  // заполняет пустой вектор копиями [first, last)
+  template <class InputIt>
+  void assign(InputIt first, InputIt last, size_type count) {
+    arr = allocate(count);
+    try {
+      constructCopy(first, last, arr);
+    } catch (...) {
+      deallocate(arr, count);
+      arr = nullptr;
+      throw;
+    }
+    m_size = m_capacity = count;
+  }
+
+  void reallocate(size_type new_capacity) {
+    value_type *buff = allocate(new_capacity);
+    try {
+      constructMove(arr, arr + m_size, buff);
+    } catch (...) {
+      deallocate(buff, new_capacity);
+      throw;
+    }
+    destroy(arr, arr + m_size);
+    deallocate(arr, m_capacity);
+    arr = buff;
+    m_capacity = new_capacity;
+  }
+
+  template <class... Args>
+  void resizeWith(size_type count, const Args &...args) {
+    if (count <= m_size) {
+      destroy(arr + count, arr + m_size);
+      m_size = count;
+      return;
+    }
+    if (count > m_capacity) reallocate(std::max(count, growth()));
+    for (; m_size < count; ++m_size)
+      alloc_traits::construct(alloc_, arr + m_size, args...);
+  }
+
   size_t m_size;
   size_t m_capacity;
   value_type *arr;
-};
\ No newline at end of file
+  allocator_type alloc_;
+};
+
+}  // namespace s21
+
+#endif  // S21_VECTOR_H
@@ -1,12 +1,23 @@
 #ifndef S21_TREE_H
 #define S21_TREE_H
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <tuple>
 #include <ostream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "node_pool.h"
+
 namespace s21 {
 
+enum class NodeColor : bool { kRed, kBlack };
+
 template <class K, class T = int, class Compare = std::less<K>>
 struct TNode {
   using value_type = std::pair<const K, T>;
@@ -16,16 +27,37 @@ struct TNode {
   TNode *left;
   TNode *right;
   TNode *parent;
+  NodeColor color;
+  std::uint32_t source{};  // номер слябов в пуле дерева, см. NodePool::adopt
 
+  // новый узел всегда красный, корень перекрашивается в insertFixup
   explicit TNode(const_reference value)
-      : data(value), left(nullptr), right(nullptr), parent(nullptr){};
+      : data(value),
+        left(nullptr),
+        right(nullptr),
+        parent(nullptr),
+        color(NodeColor::kRed){};
+  // значение строится прямо в узле из аргументов конструктора pair
+  template <class... Args>
+  explicit TNode(std::in_place_t, Args &&...args)
+      : data(std::forward<Args>(args)...),
+        left(nullptr),
+        right(nullptr),
+        parent(nullptr),
+        color(NodeColor::kRed) {}
   explicit TNode(TNode *x)
-      : data(x->data), left(x->left), right(x->right), parent(x->parent){};
+      : data(x->data),
+        left(x->left),
+        right(x->right),
+        parent(x->parent),
+        color(x->color){};
 };
 
-template <class K, class T, class Compare = std::less<K>>
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
 class Tree {
  public:
+  using allocator_type = Allocator;
   using key_type = K;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
@@ -33,6 +65,7 @@ class Tree {
   using const_reference = const value_type &;
   using tnode = TNode<K, T>;
   using size_type = size_t;
+  using pool_type = NodePool<tnode, allocator_type>;
 
  public:
   class mapIterator {
@@ -56,13 +89,6 @@ class Tree {
       return a.current != current;
     }
 
-    void clean_iterator() {
-      if (current == nullptr)
-        return;
-      else
-        delete current;
-    }
-
    protected:
     tnode *current{};
 
@@ -83,18 +109,86 @@ class Tree {
   using insert_result = std::pair<iterator, bool>;
   using const_iterator = constMapIterator;
 
+  // Узел, вынутый из дерева: владеет значением и держит слябы пула, в
+  // которых лежит, поэтому переживает исходное дерево
+  class node_type {
+   public:
+    node_type() = default;
+    node_type(node_type &&other) noexcept { swap(other); }
+    node_type &operator=(node_type &&other) noexcept {
+      node_type(std::move(other)).swap(*this);
+      return *this;
+    }
+    ~node_type() { reset(); }
+
+    [[nodiscard]] bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    allocator_type get_allocator() const { return *alloc_; }
+
+    key_type &key() const { return const_cast<key_type &>(node_->data.first); }
+    mapped_type &mapped() const { return node_->data.second; }
+    const key_type &value() const { return node_->data.first; }  // множества
+
+    void swap(node_type &other) noexcept {
+      std::swap(node_, other.node_);
+      std::swap(storage_, other.storage_);
+      std::swap(alloc_, other.alloc_);
+    }
+
+   private:
+    node_type(tnode *node, typename pool_type::storage_ref storage,
+              const allocator_type &alloc)
+        : node_(node), storage_(std::move(storage)), alloc_(alloc) {}
+    // значение разрушается, ячейка возвращается пулу, владеющему слябами
+    void reset() noexcept {
+      if (node_ == nullptr) return;
+      using node_allocator = typename std::allocator_traits<
+          allocator_type>::template rebind_alloc<tnode>;
+      node_allocator alloc(*alloc_);
+      std::allocator_traits<node_allocator>::destroy(alloc, node_);
+      pool_type::release(storage_, std::exchange(node_, nullptr));
+      storage_.reset();
+      alloc_.reset();
+    }
+
+    tnode *node_{};
+    typename pool_type::storage_ref storage_;
+    // пустой узел аллокатора не держит: он может не строиться по умолчанию
+    std::optional<allocator_type> alloc_;
+
+    friend class Tree;
+  };
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
  public:
   Tree() = default;
-  Tree(const Tree &m) : Tree() {
+  explicit Tree(const allocator_type &alloc) : pool_(alloc) {}
+  explicit Tree(const Compare &comp,
+                const allocator_type &alloc = allocator_type())
+      : compare_(comp), pool_(alloc) {}
+  Tree(const Tree &m)
+      : Tree(m.compare_,
+             std::allocator_traits<allocator_type>::
+                 select_on_container_copy_construction(m.get_allocator())) {
+    pool_.reserve(m.tree_size);
     root = fullcopy(m.root), tree_size = m.tree_size;
+    if (root) rightmost_ = findMaxNode(root);
   }
-  Tree(Tree &&m) noexcept : Tree() {
-    root = m.root;
-    tree_size = m.tree_size;
-    m.root = nullptr;
-  }
+  Tree(Tree &&m) noexcept : Tree() { swapTree(m); }
   ~Tree() { destroy(root); }
 
+  allocator_type get_allocator() const { return pool_.get_allocator(); }
+  Compare key_comp() const { return compare_; }
+
+  // заранее выделяет память под n узлов, чтобы вставки не шли в new
+  void reserve(size_type n) {
+    if (n > tree_size) pool_.reserve(n - tree_size);
+  }
+
   iterator begin() noexcept;
   //  [[nodiscard]] const_iterator begin() const noexcept {
   //  const_iterator(begin()); }
@@ -105,136 +199,703 @@ class Tree {
 
   tnode *get_current(iterator pos) { return pos.current; }
 
+  // вынимает узел без освобождения памяти; его можно вставить в другое
+  // дерево того же типа через insert(node_type &&)
+  node_type extract(iterator pos);
+  node_type extract(const key_type &key) { return extract(find(key)); }
+
+  // Поиск. При прозрачном Compare (std::less<> и т.п.) ключ может быть
+  // любым сравнимым типом, временный key_type не создаётся
+  iterator find(const key_type &key) { return find_data_at(key, root); }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key2 &key) {
+    return find_data_at(key, root);
+  }
+  bool contains(const key_type &key) { return containsNode(key, root); }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  bool contains(const Key2 &key) {
+    return containsNode(key, root);
+  }
+  size_type count(const key_type &key) { return countKey(key); }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  size_type count(const Key2 &key) {
+    return countKey(key);
+  }
+  iterator lower_bound(const key_type &key) { return lowerBoundNode(key); }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key2 &key) {
+    return lowerBoundNode(key);
+  }
+  iterator upper_bound(const key_type &key) { return upperBoundNode(key); }
+  template <class Key2, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key2 &key) {
+    return upperBoundNode(key);
+  }
+
  protected:
-  insert_result addnode(value_type x, tnode *&tree, bool assign);
-  iterator addnodeit(value_type x, tnode *&tree);
+  void swapTree(Tree &other) noexcept {
+    std::swap(compare_, other.compare_);
+    std::swap(root, other.root);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(tree_size, other.tree_size);
+    pool_.swap(other.pool_);
+  }
+  // Спуск к месту вставки key: возвращает пустую ссылку, куда встанет
+  // новый узел, а в parent - его родителя. Если ключ уже есть, findSlot
+  // возвращает nullptr и равный узел в parent
+  tnode **findSlot(const key_type &key, tnode *&parent);
+  tnode **findMultiSlot(const key_type &key, tnode *&parent);
+  void linkNode(tnode **link, tnode *parent, tnode *node);
+  // Вставка рядом с hint: если ключ встаёт прямо перед hint или прямо за
+  // ним, спуска от корня нет. end() означает вставку в конец
+  tnode **findHintSlot(tnode *hint, const key_type &key, tnode *&parent);
+  tnode **findHintMultiSlot(tnode *hint, const key_type &key,
+                            tnode *&parent);
+  template <class V>
+  iterator insertHint(iterator hint, const V &value, bool unique);
+  // args - аргументы конструктора value_type; узел строится до поиска
+  template <class... Args>
+  iterator emplaceHint(iterator hint, bool unique, Args &&...args);
+  // узел строится, только если ключа ещё нет
+  template <class... Args>
+  insert_result tryEmplace(const key_type &key, Args &&...args);
+  insert_return_type insertNodeUnique(node_type &&handle);
+  iterator insertNodeMulti(node_type &&handle);
+  // узлы other перевешиваются без копирования; при unique ключи, которые
+  // уже есть в *this, остаются в other
+  void mergeNodes(Tree &other, bool unique);
   tnode *fullcopy(tnode *tree);
+  // заменяет содержимое элементами [first, last) за O(n), если вход
+  // упорядочен; sorted - порядок гарантирует вызывающий, unique - из
+  // равных ключей остаётся первый
+  template <class InputIt>
+  void assignRange(InputIt first, InputIt last, bool sorted, bool unique);
+  void linkSorted(std::vector<tnode *> &nodes);
+  // у множества ключ дополняется пустым mapped_type; значение строится
+  // прямо в узле
+  template <class V>
+  tnode *makeNode(V &&value) {
+    if constexpr (std::is_convertible<V &&, value_type>::value) {
+      return pool_.create(std::in_place, std::forward<V>(value));
+    } else {
+      return pool_.create(std::in_place, std::piecewise_construct,
+                          std::forward_as_tuple(std::forward<V>(value)),
+                          std::tuple<>());
+    }
+  }
+  // V - value_type или key_type множества; узел строится из value, только
+  // если ключ можно вставить
+  template <class V>
+  insert_result insertUnique(V &&value);
+  template <class V>
+  iterator insertMulti(V &&value);
+  // args - аргументы конструктора value_type
+  template <class... Args>
+  insert_result emplaceUnique(Args &&...args);
+  template <class... Args>
+  iterator emplaceMulti(Args &&...args);
+  static const key_type &keyOf(const value_type &value) {
+    return value.first;
+  }
+  static const key_type &keyOf(const key_type &key) { return key; }
   void destroy(tnode *tree);
+  // узел мог прийти из другого дерева: ячейка уходит владельцу слябов
+  void freeNode(tnode *node) noexcept { pool_.destroy(node, node->source); }
   void eraseNode(tnode *&node);
+  void unlinkNode(tnode *node);  // исключает узел, не освобождая его
   tnode *findMaxNode(tnode *node);
-  tnode *find_data_at(const key_type &key, tnode *node);
+  // KeyLike - key_type или тип, сравнимый с ним через прозрачный Compare
+  template <class KeyLike>
+  tnode *find_data_at(const KeyLike &key, tnode *node);
+  template <class KeyLike>
+  tnode *lowerBoundNode(const KeyLike &key);  // первый ключ не меньше key
+  template <class KeyLike>
+  tnode *upperBoundNode(const KeyLike &key);  // первый ключ больше key
+  template <class KeyLike>
+  size_type countKey(const KeyLike &key);
 
-  bool containsNode(const key_type &key, tnode *node);
+  template <class KeyLike>
+  bool containsNode(const KeyLike &key, tnode *node);
+
+  // балансировка красно-чёрного дерева
+  static bool isRed(const tnode *node) {
+    return node && node->color == NodeColor::kRed;
+  }
+  static bool isBlack(const tnode *node) { return !isRed(node); }
+  void rotateLeft(tnode *node);
+  void rotateRight(tnode *node);
+  void transplant(tnode *from, tnode *to);
+  void insertFixup(tnode *node);
+  void eraseFixup(tnode *node, tnode *parent);
 
  protected:
   //  Compare comp;
   Compare compare_{};
   tnode *root{};
+  tnode *rightmost_{};  // максимум: вставка в конец без спуска
   size_type tree_size{};
+  NodePool<tnode, allocator_type> pool_;
 
   friend class mapIterator;
 };
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::iterator Tree<K, T, Compare>::begin() noexcept {
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::begin() noexcept {
   tnode *node = root;
-  if (!root) {
-    mapped_type fake_value{};
-    key_type fake_key{};
-    auto *fake_node = new tnode(std::pair(fake_key, fake_value));
-    node = fake_node;
-    delete fake_node;
-  }
+  if (!root) return end();
   while (node->left) {
     node = node->left;
   }
   return iterator(node);
 }
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::insert_result Tree<K, T, Compare>::addnode(
-    Tree::value_type x, Tree::tnode *&tree, bool assign) {
-  insert_result result(tree, false);
-  if (tree == nullptr) {
-    result.first = tree = new tnode(x);
-    result.second = true;
-    ++tree_size;
-  } else if (compare_(x.first, tree->data.first)) {
-    result = addnode(x, tree->left, assign);
-    tree->left->parent = tree;
-  } else if (compare_(tree->data.first, x.first)) {
-    result = addnode(x, tree->right, assign);
-    tree->right->parent = tree;
-  } else if (assign) {
-    tree->data.second = x.second;
-    //    result.second = true;
-    ++tree_size;
+
+template <class K, class T, class Compare, class Allocator>
+template <class V>
+typename Tree<K, T, Compare, Allocator>::insert_result
+Tree<K, T, Compare, Allocator>::insertUnique(V &&value) {
+  tnode *parent;
+  tnode **link = findSlot(keyOf(value), parent);
+  if (link == nullptr) return {iterator(parent), false};
+  tnode *node = makeNode(std::forward<V>(value));
+  linkNode(link, parent, node);
+  return {iterator(node), true};
+}
+template <class K, class T, class Compare, class Allocator>
+template <class V>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::insertMulti(V &&value) {
+  tnode *parent;
+  tnode **link = findMultiSlot(keyOf(value), parent);
+  tnode *node = makeNode(std::forward<V>(value));
+  linkNode(link, parent, node);
+  return iterator(node);
+}
+// ключ известен только после построения: при повторе узел сразу
+// возвращается в пул
+template <class K, class T, class Compare, class Allocator>
+template <class... Args>
+typename Tree<K, T, Compare, Allocator>::insert_result
+Tree<K, T, Compare, Allocator>::emplaceUnique(Args &&...args) {
+  tnode *node = pool_.create(std::in_place, std::forward<Args>(args)...);
+  tnode *parent;
+  tnode **link = findSlot(node->data.first, parent);
+  if (link == nullptr) {
+    pool_.destroy(node);
+    return {iterator(parent), false};
   }
-  return result;
+  linkNode(link, parent, node);
+  return {iterator(node), true};
+}
+template <class K, class T, class Compare, class Allocator>
+template <class... Args>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::emplaceMulti(Args &&...args) {
+  tnode *node = pool_.create(std::in_place, std::forward<Args>(args)...);
+  tnode *parent;
+  tnode **link = findMultiSlot(node->data.first, parent);
+  linkNode(link, parent, node);
+  return iterator(node);
 }
 
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::tnode *Tree<K, T, Compare>::fullcopy(
-    Tree::tnode *tree) {
-  if (tree == nullptr) return nullptr;
-  auto *newNode = new tnode(tree->data);
-  newNode->left = fullcopy(tree->left);
-  newNode->right = fullcopy(tree->right);
-  return newNode;
-}
-
-template <class K, class T, class Compare>
-void Tree<K, T, Compare>::destroy(Tree::tnode *tree) {
-  if (tree == nullptr) return;
-  destroy(tree->left);
-  destroy(tree->right);
-  delete tree;
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode **
+Tree<K, T, Compare, Allocator>::findSlot(const key_type &key,
+                                         tnode *&parent) {
+  parent = nullptr;
+  tnode **link = &root;
+  while (*link) {
+    parent = *link;
+    if (compare_(key, parent->data.first)) {
+      link = &parent->left;
+    } else if (compare_(parent->data.first, key)) {
+      link = &parent->right;
+    } else {
+      return nullptr;
+    }
+  }
+  return link;
+}
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode **
+Tree<K, T, Compare, Allocator>::findMultiSlot(const key_type &key,
+                                              tnode *&parent) {
+  parent = nullptr;
+  tnode **link = &root;
+  while (*link) {
+    parent = *link;
+    link = compare_(parent->data.first, key) ? &parent->right : &parent->left;
+  }
+  return link;
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::linkNode(tnode **link, tnode *parent,
+                                              tnode *node) {
+  if (parent == nullptr || (parent == rightmost_ && link == &parent->right))
+    rightmost_ = node;
+  node->left = node->right = nullptr;
+  node->parent = parent;
+  node->color = NodeColor::kRed;
+  *link = node;
+  ++tree_size;
+  insertFixup(node);
+}
+
+// Ключ встаёт между соседями prev и next, где next - hint: у одного из
+// них на этом месте всегда пустая ссылка. Неверный hint стоит обычного
+// спуска
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode **
+Tree<K, T, Compare, Allocator>::findHintSlot(tnode *hint, const key_type &key,
+                                             tnode *&parent) {
+  if (hint == nullptr) {
+    if (rightmost_ && compare_(rightmost_->data.first, key)) {
+      parent = rightmost_;
+      return &rightmost_->right;
+    }
+  } else if (compare_(key, hint->data.first)) {
+    tnode *prev = (--iterator(hint)).current;
+    if (prev == nullptr || compare_(prev->data.first, key)) {
+      parent = hint->left ? prev : hint;
+      return hint->left ? &prev->right : &hint->left;
+    }
+  } else if (compare_(hint->data.first, key)) {
+    tnode *next = hint == rightmost_ ? nullptr : (++iterator(hint)).current;
+    if (next == nullptr || compare_(key, next->data.first)) {
+      parent = hint->right ? next : hint;
+      return hint->right ? &next->left : &hint->right;
+    }
+  } else {
+    parent = hint;
+    return nullptr;
+  }
+  return findSlot(key, parent);
+}
+// равные ключи допустимы с обеих сторон
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode **
+Tree<K, T, Compare, Allocator>::findHintMultiSlot(tnode *hint,
+                                                  const key_type &key,
+                                                  tnode *&parent) {
+  if (hint == nullptr) {
+    if (rightmost_ && !compare_(key, rightmost_->data.first)) {
+      parent = rightmost_;
+      return &rightmost_->right;
+    }
+  } else if (!compare_(hint->data.first, key)) {
+    tnode *prev = (--iterator(hint)).current;
+    if (prev == nullptr || !compare_(key, prev->data.first)) {
+      parent = hint->left ? prev : hint;
+      return hint->left ? &prev->right : &hint->left;
+    }
+  }
+  return findMultiSlot(key, parent);
+}
+template <class K, class T, class Compare, class Allocator>
+template <class V>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::insertHint(iterator hint, const V &value,
+                                           bool unique) {
+  const key_type &key = keyOf(value);
+  tnode *parent;
+  tnode **link = unique ? findHintSlot(hint.current, key, parent)
+                        : findHintMultiSlot(hint.current, key, parent);
+  if (link == nullptr) return iterator(parent);
+  tnode *node = makeNode(value);
+  linkNode(link, parent, node);
+  return iterator(node);
+}
+template <class K, class T, class Compare, class Allocator>
+template <class... Args>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::emplaceHint(iterator hint, bool unique,
+                                            Args &&...args) {
+  tnode *node = pool_.create(std::in_place, std::forward<Args>(args)...);
+  tnode *parent;
+  tnode **link =
+      unique ? findHintSlot(hint.current, node->data.first, parent)
+             : findHintMultiSlot(hint.current, node->data.first, parent);
+  if (link == nullptr) {
+    pool_.destroy(node);
+    return iterator(parent);
+  }
+  linkNode(link, parent, node);
+  return iterator(node);
+}
+template <class K, class T, class Compare, class Allocator>
+template <class... Args>
+typename Tree<K, T, Compare, Allocator>::insert_result
+Tree<K, T, Compare, Allocator>::tryEmplace(const key_type &key,
+                                           Args &&...args) {
+  tnode *parent;
+  tnode **link = findSlot(key, parent);
+  if (link == nullptr) return {iterator(parent), false};
+  tnode *node = pool_.create(
+      std::in_place, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  linkNode(link, parent, node);
+  return {iterator(node), true};
+}
+
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::node_type
+Tree<K, T, Compare, Allocator>::extract(iterator pos) {
+  tnode *node = pos.current;
+  if (node == nullptr) return node_type();
+  unlinkNode(node);
   --tree_size;
+  node_type handle(node, pool_.owner(node->source), get_allocator());
+  pool_.disown(node->source);
+  return handle;
 }
-template <class K, class T, class Compare>
-void Tree<K, T, Compare>::eraseNode(Tree::tnode *&node) {
-  if (node == nullptr) return;
-  if (!node->left && !node->right) {
-    if (node == root) {
-      root = nullptr;
-    } else if (node == node->parent->left) {
-      node->parent->left = nullptr;
-    } else {
-      node->parent->right = nullptr;
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::insert_return_type
+Tree<K, T, Compare, Allocator>::insertNodeUnique(node_type &&handle) {
+  if (handle.empty()) return {end(), false, node_type()};
+  tnode *parent;
+  tnode **link = findSlot(handle.node_->data.first, parent);
+  if (link == nullptr) return {iterator(parent), false, std::move(handle)};
+  handle.node_->source = pool_.adopt(handle.storage_);
+  tnode *node = std::exchange(handle.node_, nullptr);
+  handle.storage_.reset();
+  linkNode(link, parent, node);
+  return {iterator(node), true, node_type()};
+}
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::iterator
+Tree<K, T, Compare, Allocator>::insertNodeMulti(node_type &&handle) {
+  if (handle.empty()) return end();
+  tnode *parent;
+  tnode **link = findMultiSlot(handle.node_->data.first, parent);
+  handle.node_->source = pool_.adopt(handle.storage_);
+  tnode *node = std::exchange(handle.node_, nullptr);
+  handle.storage_.reset();
+  linkNode(link, parent, node);
+  return iterator(node);
+}
+// узел отцепляется после шага итератора: перестройка other не трогает
+// следующий узел, он лишь меняет ссылки
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::mergeNodes(Tree &other, bool unique) {
+  if (&other == this || other.root == nullptr) return;
+  for (iterator it = other.begin(); it != other.end();) {
+    tnode *node = it.current;
+    ++it;
+    tnode *parent;
+    tnode **link = unique ? findSlot(node->data.first, parent)
+                          : findMultiSlot(node->data.first, parent);
+    if (link == nullptr) continue;
+    auto source = node->source;
+    node->source = pool_.adopt(other.pool_.owner(source));
+    other.unlinkNode(node);
+    --other.tree_size;
+    other.pool_.disown(source);
+    linkNode(link, parent, node);
+  }
+}
+
+// Прямой обход с явным стеком пар (оригинал, копия), дети которых ещё не
+// скопированы. Стек не глубже высоты дерева, а копии ложатся в память в
+// порядке обхода
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode *
+Tree<K, T, Compare, Allocator>::fullcopy(Tree::tnode *tree) {
+  if (tree == nullptr) return nullptr;
+  auto clone = [this](const tnode *from, tnode *parent) {
+    tnode *to = pool_.create(from->data);
+    to->color = from->color;
+    to->parent = parent;
+    return to;
+  };
+  tnode *top = clone(tree, nullptr);
+  std::vector<std::pair<const tnode *, tnode *>> pending{{tree, top}};
+  while (!pending.empty()) {
+    auto [from, to] = pending.back();
+    pending.pop_back();
+    if (from->right) {
+      to->right = clone(from->right, to);
+      pending.emplace_back(from->right, to->right);
+    }
+    if (from->left) {
+      to->left = clone(from->left, to);
+      pending.emplace_back(from->left, to->left);
     }
-  } else if (node->left && !node->right) {
-    if (node == root) {
-      root = node->left;
-    } else if (node == node->parent->left) {
-      node->parent->left = node->left;
+  }
+  return top;
+}
+
+template <class K, class T, class Compare, class Allocator>
+template <class InputIt>
+void Tree<K, T, Compare, Allocator>::assignRange(InputIt first, InputIt last,
+                                                 bool sorted, bool unique) {
+  destroy(root);
+  root = nullptr;
+  std::vector<tnode *> nodes;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    auto count = static_cast<size_type>(std::distance(first, last));
+    nodes.reserve(count);
+    pool_.reserve(count);
+  }
+  try {
+    for (; first != last; ++first) nodes.push_back(makeNode(*first));
+  } catch (...) {
+    for (tnode *node : nodes) pool_.destroy(node);
+    throw;
+  }
+  auto less = [this](const tnode *a, const tnode *b) {
+    return compare_(a->data.first, b->data.first);
+  };
+  if (!sorted && !std::is_sorted(nodes.begin(), nodes.end(), less))
+    std::stable_sort(nodes.begin(), nodes.end(), less);
+  if (unique) {
+    size_type kept = 0;
+    for (tnode *node : nodes) {
+      if (kept && !less(nodes[kept - 1U], node)) {
+        pool_.destroy(node);
+      } else {
+        nodes[kept++] = node;
+      }
+    }
+    nodes.resize(kept);
+  }
+  tree_size = nodes.size();
+  linkSorted(nodes);
+}
+
+// Корень каждого поддерева - середина его диапазона, поэтому все листья
+// лежат на двух нижних уровнях. Нижний уровень красный, остальные чёрные:
+// чёрная высота всех путей одинакова. Диапазоны обходятся симметрично со
+// стеком глубины O(log n): узлы связываются в порядке ключей, то есть
+// подряд по памяти, а не вразброс. Узлы приходят из makeNode с пустыми
+// ссылками на детей
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::linkSorted(std::vector<tnode *> &nodes) {
+  struct Range {
+    size_type lo, hi, depth;
+    tnode *parent;
+    bool left;
+  };
+  size_type deepest = 0;
+  while ((size_type{2} << deepest) <= nodes.size()) ++deepest;
+  std::vector<Range> ranges;
+  Range range{0U, nodes.size(), 0U, nullptr, false};
+  root = nullptr;
+  while (range.lo != range.hi || !ranges.empty()) {
+    while (range.lo != range.hi) {
+      ranges.push_back(range);
+      size_type mid = range.lo + (range.hi - range.lo) / 2U;
+      range = {range.lo, mid, range.depth + 1U, nodes[mid], true};
+    }
+    range = ranges.back();
+    ranges.pop_back();
+    size_type mid = range.lo + (range.hi - range.lo) / 2U;
+    tnode *node = nodes[mid];
+    node->parent = range.parent;
+    node->color = range.depth == deepest && deepest > 0U ? NodeColor::kRed
+                                                         : NodeColor::kBlack;
+    if (range.parent == nullptr) {
+      root = node;
+    } else if (range.left) {
+      range.parent->left = node;
     } else {
-      node->parent->right = node->left;
+      range.parent->right = node;
     }
-    node->left->parent = node->parent;
-  } else if (node->right && !node->left) {
-    if (node == root) {
-      root = node->right;
-    } else if (node == node->parent->right) {
-      node->parent->right = node->right;
+    range = {mid + 1U, range.hi, range.depth + 1U, node, false};
+  }
+  rightmost_ = nodes.empty() ? nullptr : nodes.back();
+}
+
+// обратный обход по ссылкам на родителя: лист удаляется и отцепляется,
+// после чего его родитель сам может стать листом
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::destroy(Tree::tnode *tree) {
+  if (tree == root) rightmost_ = nullptr;
+  tnode *stop = tree ? tree->parent : nullptr;
+  while (tree) {
+    if (tree->left) {
+      tree = tree->left;
+    } else if (tree->right) {
+      tree = tree->right;
     } else {
-      node->parent->left = node->right;
+      tnode *parent = tree->parent;
+      if (parent != stop)
+        (parent->left == tree ? parent->left : parent->right) = nullptr;
+      freeNode(tree);
+      --tree_size;
+      tree = parent != stop ? parent : nullptr;
     }
-    node->right->parent = node->parent;
+  }
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::eraseNode(Tree::tnode *&node) {
+  if (node == nullptr) return;
+  unlinkNode(node);
+  freeNode(node);
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::unlinkNode(Tree::tnode *node) {
+  if (node == rightmost_)
+    rightmost_ = node->left ? findMaxNode(node->left) : node->parent;
+  NodeColor removed = node->color;
+  tnode *child = nullptr;
+  tnode *childParent = nullptr;
+  if (!node->left || !node->right) {
+    child = node->left ? node->left : node->right;
+    childParent = node->parent;
+    transplant(node, child);
   } else {
+    // узел с двумя потомками заменяется максимумом левого поддерева
     tnode *localMax = findMaxNode(node->left);
-
-    if (localMax != node->left) {
-      if (localMax->left) {
-        localMax->left->parent = localMax->parent;
-        localMax->parent->right = localMax->left;
-      }
-      localMax->parent->right = nullptr;
-      node->left->parent = localMax;
+    removed = localMax->color;
+    child = localMax->left;
+    if (localMax->parent == node) {
+      childParent = localMax;
+    } else {
+      childParent = localMax->parent;
+      transplant(localMax, localMax->left);
       localMax->left = node->left;
+      localMax->left->parent = localMax;
     }
-    localMax->parent = node->parent;
+    transplant(node, localMax);
     localMax->right = node->right;
-    node->right->parent = localMax;
-    if (node->parent && node == node->parent->right) {
-      node->parent->right = localMax;
-    } else if (node->parent && node == node->parent->left) {
-      node->parent->left = localMax;
+    localMax->right->parent = localMax;
+    localMax->color = node->color;
+  }
+  if (removed == NodeColor::kBlack) eraseFixup(child, childParent);
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::transplant(Tree::tnode *from,
+                                                Tree::tnode *to) {
+  if (from->parent == nullptr) {
+    root = to;
+  } else if (from == from->parent->left) {
+    from->parent->left = to;
+  } else {
+    from->parent->right = to;
+  }
+  if (to) to->parent = from->parent;
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::rotateLeft(Tree::tnode *node) {
+  tnode *pivot = node->right;
+  node->right = pivot->left;
+  if (pivot->left) pivot->left->parent = node;
+  transplant(node, pivot);
+  pivot->left = node;
+  node->parent = pivot;
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::rotateRight(Tree::tnode *node) {
+  tnode *pivot = node->left;
+  node->left = pivot->right;
+  if (pivot->right) pivot->right->parent = node;
+  transplant(node, pivot);
+  pivot->right = node;
+  node->parent = pivot;
+}
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::insertFixup(Tree::tnode *node) {
+  while (isRed(node->parent)) {
+    tnode *parent = node->parent;
+    tnode *grand = parent->parent;
+    if (parent == grand->left) {
+      tnode *uncle = grand->right;
+      if (isRed(uncle)) {
+        parent->color = uncle->color = NodeColor::kBlack;
+        grand->color = NodeColor::kRed;
+        node = grand;
+        continue;
+      }
+      if (node == parent->right) {
+        rotateLeft(parent);
+        node = parent;
+        parent = node->parent;
+      }
+      parent->color = NodeColor::kBlack;
+      grand->color = NodeColor::kRed;
+      rotateRight(grand);
+    } else {
+      tnode *uncle = grand->left;
+      if (isRed(uncle)) {
+        parent->color = uncle->color = NodeColor::kBlack;
+        grand->color = NodeColor::kRed;
+        node = grand;
+        continue;
+      }
+      if (node == parent->left) {
+        rotateRight(parent);
+        node = parent;
+        parent = node->parent;
+      }
+      parent->color = NodeColor::kBlack;
+      grand->color = NodeColor::kRed;
+      rotateLeft(grand);
     }
-    if (node->parent == nullptr) root = localMax;
   }
-  delete node;
+  root->color = NodeColor::kBlack;
 }
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::tnode *Tree<K, T, Compare>::findMaxNode(
-    Tree::tnode *node) {
+template <class K, class T, class Compare, class Allocator>
+void Tree<K, T, Compare, Allocator>::eraseFixup(Tree::tnode *node,
+                                                Tree::tnode *parent) {
+  // node может быть nullptr (чёрный лист), поэтому родитель передаётся явно
+  while (node != root && isBlack(node)) {
+    if (node == parent->left) {
+      tnode *brother = parent->right;
+      if (isRed(brother)) {
+        brother->color = NodeColor::kBlack;
+        parent->color = NodeColor::kRed;
+        rotateLeft(parent);
+        brother = parent->right;
+      }
+      if (isBlack(brother->left) && isBlack(brother->right)) {
+        brother->color = NodeColor::kRed;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (isBlack(brother->right)) {
+          brother->left->color = NodeColor::kBlack;
+          brother->color = NodeColor::kRed;
+          rotateRight(brother);
+          brother = parent->right;
+        }
+        brother->color = parent->color;
+        parent->color = NodeColor::kBlack;
+        brother->right->color = NodeColor::kBlack;
+        rotateLeft(parent);
+        node = root;
+      }
+    } else {
+      tnode *brother = parent->left;
+      if (isRed(brother)) {
+        brother->color = NodeColor::kBlack;
+        parent->color = NodeColor::kRed;
+        rotateRight(parent);
+        brother = parent->left;
+      }
+      if (isBlack(brother->left) && isBlack(brother->right)) {
+        brother->color = NodeColor::kRed;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (isBlack(brother->left)) {
+          brother->right->color = NodeColor::kBlack;
+          brother->color = NodeColor::kRed;
+          rotateLeft(brother);
+          brother = parent->left;
+        }
+        brother->color = parent->color;
+        parent->color = NodeColor::kBlack;
+        brother->left->color = NodeColor::kBlack;
+        rotateRight(parent);
+        node = root;
+      }
+    }
+  }
+  if (node) node->color = NodeColor::kBlack;
+}
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::tnode *
+Tree<K, T, Compare, Allocator>::findMaxNode(Tree::tnode *node) {
   if (!node->right) return node;
   while (node->right) {
     node = node->right;
@@ -242,54 +903,76 @@ typename Tree<K, T, Compare>::tnode *Tree<K, T, Compare>::findMaxNode(
   return node;
 }
 
-template <class K, class T, class Compare>
-bool Tree<K, T, Compare>::containsNode(const key_type &key, Tree::tnode *node) {
-  if (!node) return false;
-  if (!compare_(node->data.first, key) && !compare_(key, node->data.first))
-    return true;
-  bool status = false;
-  if (compare_(key, node->data.first)) status = containsNode(key, node->left);
-  if (compare_(node->data.first, key)) status = containsNode(key, node->right);
-  return status;
-}
-
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::iterator Tree<K, T, Compare>::addnodeit(
-    Tree::value_type x, Tree::tnode *&tree) {
-  iterator result(tree);
-  if (tree == nullptr) {
-    ++tree_size;
-    tree = new tnode(x);
-    result = tree;
-  } else if (compare_(x.first, tree->data.first) ||
-             (!compare_(x.first, tree->data.first) &&
-              !compare_(tree->data.first, x.first))) {
-    result = addnodeit(x, tree->left);
-    tree->left->parent = tree;
-  } else if (compare_(tree->data.first, x.first)) {
-    result = addnodeit(x, tree->right);
-    tree->right->parent = tree;
+template <class K, class T, class Compare, class Allocator>
+template <class KeyLike>
+bool Tree<K, T, Compare, Allocator>::containsNode(const KeyLike &key,
+                                                  Tree::tnode *node) {
+  return find_data_at(key, node) != nullptr;
+}
+
+// одно сравнение на уровень: спуск ищет первый ключ не меньше key, и лишь
+// в конце проверяется равенство
+template <class K, class T, class Compare, class Allocator>
+template <class KeyLike>
+typename Tree<K, T, Compare, Allocator>::tnode *
+Tree<K, T, Compare, Allocator>::find_data_at(const KeyLike &key,
+                                             Tree::tnode *node) {
+  tnode *candidate = nullptr;
+  while (node) {
+    if (compare_(node->data.first, key)) {
+      node = node->right;
+    } else {
+      candidate = node;
+      node = node->left;
+    }
+  }
+  return candidate && !compare_(key, candidate->data.first) ? candidate
+                                                            : nullptr;
+}
+
+template <class K, class T, class Compare, class Allocator>
+template <class KeyLike>
+typename Tree<K, T, Compare, Allocator>::tnode *
+Tree<K, T, Compare, Allocator>::lowerBoundNode(const KeyLike &key) {
+  tnode *result = nullptr;
+  for (tnode *node = root; node;) {
+    if (compare_(node->data.first, key)) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
   }
   return result;
 }
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::tnode *Tree<K, T, Compare>::find_data_at(
-    const key_type &key, Tree::tnode *node) {
-  if (node == nullptr) {
-    return nullptr;
-  } else {
-    if (!compare_(node->data.first, key) && !compare_(key, node->data.first))
-      return node;
-    if (compare_(key, node->data.first))
-      return find_data_at(key, node->left);
-    else
-      return find_data_at(key, node->right);
+template <class K, class T, class Compare, class Allocator>
+template <class KeyLike>
+typename Tree<K, T, Compare, Allocator>::tnode *
+Tree<K, T, Compare, Allocator>::upperBoundNode(const KeyLike &key) {
+  tnode *result = nullptr;
+  for (tnode *node = root; node;) {
+    if (compare_(key, node->data.first)) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
   }
+  return result;
+}
+template <class K, class T, class Compare, class Allocator>
+template <class KeyLike>
+typename Tree<K, T, Compare, Allocator>::size_type
+Tree<K, T, Compare, Allocator>::countKey(const KeyLike &key) {
+  size_type result = 0U;
+  iterator last = upperBoundNode(key);
+  for (iterator i = lowerBoundNode(key); i != last; ++i) ++result;
+  return result;
 }
 
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::mapIterator &
-Tree<K, T, Compare>::mapIterator::operator++() {
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::mapIterator &
+Tree<K, T, Compare, Allocator>::mapIterator::operator++() {
   if (current->right) {
     current = current->right;
     while (current->left) {
@@ -305,16 +988,16 @@ Tree<K, T, Compare>::mapIterator::operator++() {
   }
   return *this;
 }
-template <class K, class T, class Compare>
-const typename Tree<K, T, Compare>::mapIterator
-Tree<K, T, Compare>::mapIterator::operator++(int) {
+template <class K, class T, class Compare, class Allocator>
+const typename Tree<K, T, Compare, Allocator>::mapIterator
+Tree<K, T, Compare, Allocator>::mapIterator::operator++(int) {
   mapIterator temp = *this;
   ++(*this);
   return temp;
 }
-template <class K, class T, class Compare>
-typename Tree<K, T, Compare>::mapIterator &
-Tree<K, T, Compare>::mapIterator::operator--() {
+template <class K, class T, class Compare, class Allocator>
+typename Tree<K, T, Compare, Allocator>::mapIterator &
+Tree<K, T, Compare, Allocator>::mapIterator::operator--() {
   if (current->left) {
     current = current->left;
     while (current->right) {
@@ -330,9 +1013,9 @@ Tree<K, T, Compare>::mapIterator::operator--() {
   }
   return *this;
 }
-template <class K, class T, class Compare>
-const typename Tree<K, T, Compare>::mapIterator
-Tree<K, T, Compare>::mapIterator::operator--(int) {
+template <class K, class T, class Compare, class Allocator>
+const typename Tree<K, T, Compare, Allocator>::mapIterator
+Tree<K, T, Compare, Allocator>::mapIterator::operator--(int) {
   mapIterator temp = *this;
   --(*this);
   return temp;
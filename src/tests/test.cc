@@ -1,10 +1,42 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <deque>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include "../libraries/s21_containers.h"
 #include "../libraries/s21_containersplus.h"
 
+// аллокатор, считающий живые выделения, для проверки allocator-aware API
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+  long *live;
+  explicit CountingAllocator(long *counter) : live(counter) {}
+  template <class U>
+  CountingAllocator(const CountingAllocator<U> &other) : live(other.live) {}
+  T *allocate(std::size_t n) {
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) {
+    --*live;
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <class U>
+  bool operator==(const CountingAllocator<U> &other) const {
+    return live == other.live;
+  }
+  template <class U>
+  bool operator!=(const CountingAllocator<U> &other) const {
+    return live != other.live;
+  }
+};
+
 TEST(StackTest, stack) {
   s21::Stack<int> n = {1, 2, 3, 4};
   s21::Stack<int> k(n);
@@ -53,6 +85,42 @@ TEST(DequeTest, deque) {
   EXPECT_EQ(n.front(), 9);
 }
 
+TEST(DequeTest, blocksAndRandomAccess) {
+  s21::Deque<int> n;
+  std::deque<int> nstd;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3) {
+      n.push_back(i);
+      nstd.push_back(i);
+    } else {
+      n.push_front(i);
+      nstd.push_front(i);
+    }
+  }
+  for (int i = 0; i < 1500; ++i) {
+    n.pop_front();
+    nstd.pop_front();
+    if (i % 2) {
+      n.pop_back();
+      nstd.pop_back();
+    }
+  }
+  ASSERT_EQ(n.size(), nstd.size());
+  for (std::size_t i = 0; i < nstd.size(); ++i) EXPECT_EQ(n[i], nstd[i]);
+  s21::Deque<int> copy(n);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), nstd.begin()));
+  EXPECT_EQ(copy.end() - copy.begin(), static_cast<long>(nstd.size()));
+  copy[0] = -1;
+  EXPECT_EQ(copy.front(), -1);
+  EXPECT_EQ(n.front(), nstd.front());
+  EXPECT_ANY_THROW(n.at(nstd.size()));
+  while (!n.empty()) n.pop_back();
+  n.push_front(1);
+  n.push_back(2);
+  EXPECT_EQ(n.front(), 1);
+  EXPECT_EQ(n.back(), 2);
+}
+
 TEST(ArrayTest, array) {
   s21::Array<int, 5> n = {1, 2, 3, 4, 5};
   std::array<int, 5> nstd = {1, 2, 3, 4, 5};
@@ -91,3 +159,304 @@ TEST(ArrayTest, array) {
   //   EXPECT_EQ(err.what(), std::string("Incorrect input, no index"));
   // }
 }
+
+TEST(AllocatorTest, containersUseAllocator) {
+  long live = 0;
+  {
+    CountingAllocator<int> alloc(&live);
+    s21::Vector<int, CountingAllocator<int>> vec(alloc);
+    s21::List<int, CountingAllocator<int>> lst(alloc);
+    s21::Deque<int, CountingAllocator<int>> deq(alloc);
+    for (int i = 0; i < 10; ++i) {
+      vec.push_back(i);
+      lst.push_back(i);
+      deq.push_back(i);
+    }
+    EXPECT_GT(live, 0);
+    CountingAllocator<std::pair<const int, int>> pair_alloc(&live);
+    s21::map<int, int, std::less<int>,
+             CountingAllocator<std::pair<const int, int>>>
+        mp(pair_alloc);
+    s21::set<int, std::less<int>, CountingAllocator<int>> st(alloc);
+    long before = live;
+    mp.insert(1, 1);
+    st.insert(1);
+    EXPECT_GT(live, before);
+    s21::set<int, std::less<int>, CountingAllocator<int>> copy(st);
+    EXPECT_TRUE(copy.get_allocator() == alloc);
+    EXPECT_EQ(vec[9] + lst.back() + deq.back() + mp.at(1), 28);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// узлы ходят между деревьями и удаляются в чужом: ячейки должны
+// возвращаться в исходный пул, а не копиться до его разрушения
+TEST(AllocatorTest, movedNodesReturnToTheirPool) {
+  long live = 0;
+  {
+    using alloc_type = CountingAllocator<std::pair<const int, int>>;
+    alloc_type alloc(&live);
+    s21::map<int, int, std::less<int>, alloc_type> pending(alloc);
+    s21::map<int, int, std::less<int>, alloc_type> active(alloc);
+    s21::map<int, int, std::less<int>, alloc_type> merged(alloc);
+    const int batch = 64;
+    long warmed = 0;
+    for (int cycle = 0; cycle < 200; ++cycle) {
+      int first = cycle * batch;
+      for (int key = first; key < first + batch; ++key)
+        pending.insert(key, key);
+      for (int key = first; key < first + batch / 2; ++key)
+        active.insert(pending.extract(key));
+      // отброшенный узел тоже возвращается в пул
+      pending.extract(first + batch / 2);
+      merged.merge(pending);
+      ASSERT_TRUE(pending.empty());
+      for (int key = first - batch; key < first; ++key) {
+        if (active.contains(key)) active.erase(active.find(key));
+        if (merged.contains(key)) merged.erase(merged.find(key));
+      }
+      if (cycle == 10) warmed = live;
+    }
+    EXPECT_EQ(live, warmed);
+    EXPECT_EQ(active.size(), static_cast<size_t>(batch / 2));
+    EXPECT_EQ(merged.size(), static_cast<size_t>(batch / 2 - 1));
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// долгоживущее дерево держит слябы временных деревьев, только пока в нём
+// есть их узлы
+TEST(AllocatorTest, foreignSlabsAreReleasedWithTheirLastNode) {
+  long live = 0;
+  {
+    using alloc_type = CountingAllocator<std::pair<const int, int>>;
+    using map_type = s21::map<int, int, std::less<int>, alloc_type>;
+    alloc_type alloc(&live);
+    map_type kept(alloc);
+    kept.insert(-1, -1);
+    long warmed = 0;
+    for (int i = 0; i < 1000; ++i) {
+      {
+        map_type tmp(alloc);
+        tmp.insert(i, i);
+        tmp.insert(i + 1, i);
+        kept.insert(tmp.extract(i));
+        map_type other(alloc);
+        other.merge(tmp);
+        kept.merge(other);
+      }
+      kept.erase(kept.find(i));
+      if (i % 2 == 0) kept.erase(kept.find(i + 1));
+      // узел извлечён и отброшен: его слябы тоже отпускаются
+      kept.extract(i + 1);
+      if (i == 10) warmed = live;
+    }
+    EXPECT_EQ(live, warmed);
+    EXPECT_EQ(kept.size(), 1U);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// тип, считающий живые объекты, чтобы видеть лишние конструирования
+struct Tracked {
+  static int alive;
+  int value;
+  Tracked() : value(0) { ++alive; }
+  explicit Tracked(int v) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) { ++alive; }
+  Tracked(Tracked &&other) noexcept : value(other.value) {
+    other.value = -1;
+    ++alive;
+  }
+  Tracked &operator=(const Tracked &) = default;
+  ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+TEST(VectorTest, onlyLiveElementsAreConstructed) {
+  {
+    s21::Vector<Tracked> vec;
+    vec.reserve(1000);
+    EXPECT_EQ(Tracked::alive, 0);
+    vec.emplace_back(1);
+    Tracked moved(2);
+    vec.push_back(std::move(moved));
+    EXPECT_EQ(moved.value, -1);
+    EXPECT_EQ(Tracked::alive, 3);
+    vec.resize(5);
+    EXPECT_EQ(Tracked::alive, 6);
+    vec.resize(8, Tracked(7));
+    EXPECT_EQ(vec.size(), 8U);
+    EXPECT_EQ(vec[7].value, 7);
+    vec.resize(2);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 2U);
+    EXPECT_EQ(Tracked::alive, 3);
+    vec.push_back(vec[0]);
+    EXPECT_EQ(vec[2].value, 1);
+    s21::Vector<Tracked> copy(vec);
+    EXPECT_EQ(copy[1].value, 2);
+    vec.clear();
+    EXPECT_EQ(Tracked::alive, 4);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+  s21::Vector<int> ints(3);
+  ints.push_back(4);
+  ints.insert(ints.begin() + 1, 9);
+  ints.erase(ints.begin());
+  EXPECT_EQ(ints.size(), 4U);
+  EXPECT_EQ(ints[0], 9);
+  EXPECT_EQ(ints.back(), 4);
+}
+
+TEST(VectorTest, inPlaceInsertAndErase) {
+  s21::Vector<int> vec{1, 2, 3, 4, 5};
+  std::vector<int> vstd{1, 2, 3, 4, 5};
+  vec.reserve(32);
+  vstd.reserve(32);
+  int *storage = vec.data();
+  vec.insert(vec.begin() + 2, 10);
+  vstd.insert(vstd.begin() + 2, 10);
+  vec.insert(vec.begin() + 1, 3, vec[0]);
+  vstd.insert(vstd.begin() + 1, 3, vstd[0]);
+  int extra[] = {7, 8, 9, 10, 11, 12, 13, 14, 15};
+  vec.insert(vec.end() - 1, extra, extra + 9);
+  vstd.insert(vstd.end() - 1, extra, extra + 9);
+  vec.insert(vec.begin() + 3, extra, extra + 2);
+  vstd.insert(vstd.begin() + 3, extra, extra + 2);
+  EXPECT_EQ(vec.data(), storage);
+  auto it = vec.erase(vec.begin() + 4, vec.begin() + 9);
+  vstd.erase(vstd.begin() + 4, vstd.begin() + 9);
+  EXPECT_EQ(*it, vstd[4]);
+  vec.erase(vec.begin());
+  vstd.erase(vstd.begin());
+  vec.pop_back();
+  vstd.pop_back();
+  EXPECT_EQ(vec.data(), storage);
+  ASSERT_EQ(vec.size(), vstd.size());
+  for (std::size_t i = 0; i < vstd.size(); ++i) EXPECT_EQ(vec[i], vstd[i]);
+  vec.insert(vec.begin() + 1, 40, 0);
+  vstd.insert(vstd.begin() + 1, 40, 0);
+  EXPECT_NE(vec.data(), storage);
+  ASSERT_EQ(vec.size(), vstd.size());
+  for (std::size_t i = 0; i < vstd.size(); ++i) EXPECT_EQ(vec[i], vstd[i]);
+
+  s21::Vector<std::string> str{"Aer", "Aqua", "Ignis", "Terra"};
+  std::vector<std::string> str_std{"Aer", "Aqua", "Ignis", "Terra"};
+  str.reserve(8);
+  str.insert(str.begin() + 1, 2, str[3]);
+  str_std.insert(str_std.begin() + 1, 2, str_std[3]);
+  str.erase(str.begin() + 2, str.begin() + 4);
+  str_std.erase(str_std.begin() + 2, str_std.begin() + 4);
+  ASSERT_EQ(str.size(), str_std.size());
+  for (std::size_t i = 0; i < str_std.size(); ++i)
+    EXPECT_EQ(str[i], str_std[i]);
+}
+
+// istream_iterator однопроходный: диапазон нельзя пройти дважды
+TEST(VectorTest, insertFromInputIterator) {
+  std::istringstream input("1 2 3 4");
+  s21::Vector<int> vec{9};
+  auto it = vec.insert(vec.begin(), std::istream_iterator<int>(input),
+                       std::istream_iterator<int>());
+  EXPECT_EQ(it, vec.begin());
+  ASSERT_EQ(vec.size(), 5U);
+  int expected[] = {1, 2, 3, 4, 9};
+  for (std::size_t i = 0; i < 5U; ++i) EXPECT_EQ(vec[i], expected[i]);
+
+  std::istringstream words("Aer Ignis");
+  s21::Vector<std::string> str{"Aqua", "Terra"};
+  str.insert(str.begin() + 1, std::istream_iterator<std::string>(words),
+             std::istream_iterator<std::string>());
+  ASSERT_EQ(str.size(), 4U);
+  EXPECT_EQ(str[1], "Aer");
+  EXPECT_EQ(str[2], "Ignis");
+  EXPECT_EQ(str[3], "Terra");
+}
+
+TEST(VectorTest, triviallyCopyableRelocation) {
+  struct Point {
+    int x;
+    double y;
+  };
+  s21::Vector<Point> pts;
+  for (int i = 0; i < 100; ++i) pts.push_back({i, i * 0.5});
+  pts.insert(pts.begin() + 10, 5, Point{-1, -1.0});
+  pts.erase(pts.begin(), pts.begin() + 3);
+  pts.shrink_to_fit();
+  s21::Vector<Point> copy(pts);
+  ASSERT_EQ(copy.size(), 102U);
+  EXPECT_EQ(copy.capacity(), 102U);
+  EXPECT_EQ(copy[0].x, 3);
+  EXPECT_EQ(copy[7].x, -1);
+  EXPECT_EQ(copy[12].x, 10);
+  EXPECT_DOUBLE_EQ(copy.back().y, 49.5);
+
+  s21::Array<int, 7> odd;
+  odd.fill(42);
+  s21::Array<int, 7> odd_copy(odd);
+  for (int value : odd_copy) EXPECT_EQ(value, 42);
+}
+
+// сообщение, считающее копии и перемещения: emplace не должен делать ни
+// того, ни другого
+struct Message {
+  static int copies, moves;
+  int id;
+  std::string body;
+  Message(int message_id, std::string text)
+      : id(message_id), body(std::move(text)) {}
+  Message(const Message &other) : id(other.id), body(other.body) {
+    ++copies;
+  }
+  Message(Message &&other) noexcept
+      : id(other.id), body(std::move(other.body)) {
+    ++moves;
+  }
+  bool operator<(const Message &other) const { return id < other.id; }
+};
+int Message::copies = 0;
+int Message::moves = 0;
+
+TEST(EmplaceTest, elementsAreBuiltInPlace) {
+  s21::List<Message> list;
+  list.emplace_back(1, "Aer");
+  list.emplace_front(0, "Ignis");
+  list.emplace(list.begin(), -1, "Terra");
+  s21::Deque<Message> deque;
+  deque.emplace_back(1, "Aer");
+  deque.emplace_front(0, "Ignis");
+  s21::Stack<Message> stack;
+  stack.emplace(2, "Aqua");
+  s21::Queue<Message> queue;
+  queue.emplace(3, "Lux");
+  s21::map<int, Message> map;
+  map.emplace(std::piecewise_construct, std::forward_as_tuple(4),
+              std::forward_as_tuple(4, "Nox"));
+  map.try_emplace(5, 5, "Sol");
+  s21::set<Message> set;
+  set.emplace(6, "Umbra");
+  EXPECT_EQ(set.emplace(6, "Ventus")[0].second, false);
+  s21::multiset<Message> multiset;
+  multiset.emplace(7, "Ferrum");
+  multiset.emplace(7, "Aurum");
+  EXPECT_EQ(Message::copies + Message::moves, 0);
+
+  // rvalue-вставки только перемещают
+  list.push_back(Message(8, "Aer"));
+  list.insert(list.begin(), Message(9, "Aer"));
+  deque.push_front(Message(10, "Aer"));
+  stack.push(Message(11, "Aer"));
+  queue.push(Message(12, "Aer"));
+  set.insert(Message(13, "Aer"));
+  multiset.insert(Message(14, "Aer"));
+  map.insert({15, Message(15, "Aer")});
+  EXPECT_EQ(Message::copies, 0);
+  EXPECT_EQ(list.size(), 5U);
+  EXPECT_EQ(list.front().id, 9);
+  EXPECT_EQ(list.back().body, "Aer");
+  EXPECT_EQ(deque.front().id, 10);
+  EXPECT_EQ(map.at(4).body, "Nox");
+  EXPECT_EQ(set.size(), 2U);
+  EXPECT_EQ(multiset.size(), 3U);
+}
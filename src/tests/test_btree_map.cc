@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+
+#include "../libraries/s21_btree_map.h"
+
+using namespace std;
+
+// крупное значение: в узел влезает минимум ключей, дерево быстро растёт
+struct Heavy {
+  Heavy() = default;
+  Heavy(int v) : value(v) {}
+  int value{};
+  char payload[120]{};
+};
+
+class TestBTreeMap : public ::testing::Test {
+ public:
+  s21::btree_map<int, string> s21_map{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}, {9, "Lux"}};
+  std::map<int, string> std_map{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}, {9, "Lux"}};
+
+  template <class Map, class StdMap>
+  static void expectSame(const Map &map, const StdMap &std_map) {
+    ASSERT_EQ(map.size(), std_map.size());
+    auto it = map.begin();
+    for (const auto &item : std_map) {
+      ASSERT_NE(it, map.end());
+      EXPECT_EQ(it->first, item.first);
+      ++it;
+    }
+    EXPECT_EQ(it, map.end());
+    auto back = std_map.rbegin();
+    while (it != map.begin()) EXPECT_EQ((--it)->first, (back++)->first);
+  }
+};
+
+TEST_F(TestBTreeMap, lookup) {
+  expectSame(s21_map, std_map);
+  EXPECT_TRUE(s21_map.contains(9));
+  EXPECT_FALSE(s21_map.contains(3));
+  EXPECT_EQ(s21_map.find(2)->second, "Ignis");
+  EXPECT_EQ(s21_map.find(3), s21_map.end());
+  EXPECT_EQ(s21_map.at(1), "Terra");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  EXPECT_EQ(s21_map.lower_bound(3)->first, 5);
+  EXPECT_EQ(s21_map.upper_bound(5)->first, 9);
+  EXPECT_EQ(s21_map.count(5), 1U);
+  const auto &const_map = s21_map;
+  EXPECT_EQ(const_map.at(9), "Lux");
+  EXPECT_EQ(const_map.find(5)->second, "Aer");
+}
+
+TEST_F(TestBTreeMap, insertEraseAndMerge) {
+  EXPECT_TRUE(s21_map.insert({3, "Umbra"}).second);
+  EXPECT_FALSE(s21_map.insert(3, "Ferrum").second);
+  std_map.insert({3, "Umbra"});
+  EXPECT_FALSE(s21_map.insert_or_assign(1, "Ferrum").second);
+  std_map.insert_or_assign(1, "Ferrum");
+  EXPECT_EQ(s21_map[7], std_map[7]);
+  EXPECT_TRUE(s21_map.emplace(8, "Sol").second);
+  std_map.emplace(8, "Sol");
+  s21_map.erase(s21_map.find(5));
+  std_map.erase(5);
+  EXPECT_EQ(s21_map.erase(2), 1U);
+  std_map.erase(2);
+  expectSame(s21_map, std_map);
+  EXPECT_EQ(s21_map.at(1), "Ferrum");
+
+  s21::btree_map<int, string> other{{1, "Nox"}, {4, "Ventus"}};
+  std::map<int, string> std_other{{1, "Nox"}, {4, "Ventus"}};
+  s21_map.merge(other);
+  std_map.merge(std_other);
+  expectSame(s21_map, std_map);
+  expectSame(other, std_other);
+  EXPECT_EQ(other.at(1), "Nox");
+}
+
+TEST_F(TestBTreeMap, randomOperationsMatchStd) {
+  s21::btree_map<int, Heavy> map;
+  std::map<int, Heavy> reference;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 3000);
+  for (int i = 0; i < 30000; ++i) {
+    int k = key(gen);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(map.erase(k), reference.erase(k));
+    } else {
+      map[k].value += i;
+      reference[k].value += i;
+    }
+  }
+  expectSame(map, reference);
+  for (const auto &item : reference)
+    EXPECT_EQ(map.at(item.first).value, item.second.value);
+
+  s21::btree_map<int, Heavy> copy(map);
+  while (!map.empty()) map.erase(map.begin());
+  EXPECT_EQ(map.begin(), map.end());
+  expectSame(copy, reference);
+}
+
+TEST_F(TestBTreeMap, multimapKeepsInsertionOrderOfEqualKeys) {
+  s21::btree_multimap<int, int> map;
+  std::multimap<int, int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    map.insert(i % 37, i);
+    reference.insert({i % 37, i});
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  auto it = map.begin();
+  for (const auto &item : reference) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_EQ(map.count(3), reference.count(3));
+  EXPECT_EQ(map.find(3)->second, 3);
+  EXPECT_EQ(map.erase(3), reference.erase(3));
+  auto range = map.equal_range(4);
+  EXPECT_EQ(std::distance(range.first, range.second),
+            static_cast<std::ptrdiff_t>(reference.count(4)));
+
+  s21::btree_multimap<int, int> other{{4, -1}, {100, -2}};
+  map.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(map.count(4), reference.count(4) + 1U);
+  EXPECT_EQ((--map.end())->second, -2);
+}
+
+// значение для вставки берётся из самого дерева: деление и сдвиг узла
+// переносят его раньше, чем оно скопировано
+TEST_F(TestBTreeMap, insertValueFromSameTree) {
+  s21::btree_map<int, string> map;
+  for (int i = 0; i < 400; i += 2) map.insert(i, "Aurum" + to_string(i));
+  for (int i = 1; i < 399; i += 2) map.insert(i, map.at(i + 1));
+  for (int i = 1; i < 399; i += 2)
+    ASSERT_EQ(map.at(i), "Aurum" + to_string(i + 1));
+
+  s21::btree_multimap<int, string> multi;
+  for (int i = 0; i < 200; ++i) multi.insert(i, "Argentum" + to_string(i));
+  for (int i = 0; i < 200; ++i) multi.insert(*multi.find(i));
+  for (auto it = multi.begin(); it != multi.end(); ++it)
+    ASSERT_EQ(it->second, "Argentum" + to_string(it->first));
+  EXPECT_EQ(multi.size(), 400U);
+}
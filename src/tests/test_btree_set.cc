@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../libraries/s21_btree_set.h"
+
+using namespace std;
+
+class TestBTreeSet : public ::testing::Test {
+ public:
+  template <class Set, class StdSet>
+  static void expectSame(const Set &set, const StdSet &std_set) {
+    ASSERT_EQ(set.size(), std_set.size());
+    vector<typename Set::value_type> items(set.begin(), set.end());
+    vector<typename Set::value_type> expected(std_set.begin(), std_set.end());
+    EXPECT_EQ(items, expected);
+  }
+};
+
+TEST_F(TestBTreeSet, setMatchesStd) {
+  s21::btree_set<string> set{"Aer", "Ignis", "Terra", "Ignis"};
+  std::set<string> reference{"Aer", "Ignis", "Terra", "Ignis"};
+  expectSame(set, reference);
+  EXPECT_FALSE(set.insert("Aer").second);
+  EXPECT_EQ(*set.emplace(3U, 'x').first, "xxx");
+  reference.emplace(3U, 'x');
+  EXPECT_EQ(*set.lower_bound("B"), "Ignis");
+  EXPECT_EQ(set.find("Aqua"), set.end());
+
+  std::mt19937 gen(21);
+  for (int i = 0; i < 20000; ++i) {
+    string key = to_string(gen() % 4000);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(set.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(set.insert(key).second, reference.insert(key).second);
+    }
+  }
+  expectSame(set, reference);
+
+  s21::btree_set<string> other{"Aer", "Nox", "Ventus"};
+  std::set<string> std_other{"Aer", "Nox", "Ventus"};
+  set.merge(other);
+  reference.merge(std_other);
+  expectSame(set, reference);
+  expectSame(other, std_other);
+}
+
+TEST_F(TestBTreeSet, multisetMatchesStd) {
+  s21::btree_multiset<int> set{5, 2, 1, 2, 5, 2};
+  std::multiset<int> reference{5, 2, 1, 2, 5, 2};
+  EXPECT_EQ(set.count(2), 3U);
+  auto range = set.equal_range(2);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_EQ(set.find(7), set.end());
+
+  std::mt19937 gen(21);
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(gen() % 700);
+    if (gen() % 4 == 0) {
+      auto pos = set.find(key);
+      if (pos != set.end()) {
+        set.erase(pos);
+        reference.erase(reference.find(key));
+      }
+    } else {
+      set.insert(key);
+      reference.insert(key);
+    }
+  }
+  expectSame(set, reference);
+  EXPECT_EQ(set.erase(10), reference.erase(10));
+  for (int key = 0; key < 700; ++key)
+    ASSERT_EQ(set.count(key), reference.count(key));
+
+  s21::btree_multiset<int> moved(std::move(set));
+  EXPECT_TRUE(set.empty());
+  s21::btree_multiset<int> other{1, 1};
+  moved.merge(other);
+  reference.insert({1, 1});
+  EXPECT_TRUE(other.empty());
+  expectSame(moved, reference);
+}
+
+TEST_F(TestBTreeSet, multisetInsertsOwnElement) {
+  s21::btree_multiset<string> set;
+  std::multiset<string> reference;
+  for (int i = 0; i < 300; ++i) {
+    set.insert("Cuprum-Stannum-" + to_string(i));
+    reference.insert("Cuprum-Stannum-" + to_string(i));
+  }
+  for (int i = 0; i < 300; ++i) {
+    set.insert(*set.find("Cuprum-Stannum-" + to_string(i)));
+    reference.insert("Cuprum-Stannum-" + to_string(i));
+  }
+  expectSame(set, reference);
+}
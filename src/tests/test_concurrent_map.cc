@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_concurrent_map.h"
+
+using namespace std;
+
+class TestConcurrentMap : public ::testing::Test {
+ public:
+  template <class Map, class StdMap>
+  static void expectSame(const Map &map, const StdMap &std_map) {
+    vector<pair<typename Map::key_type, typename Map::mapped_type>> items;
+    map.for_each([&items](const auto &item) { items.push_back(item); });
+    vector<pair<typename Map::key_type, typename Map::mapped_type>> expected(
+        std_map.begin(), std_map.end());
+    EXPECT_EQ(items, expected);
+    EXPECT_EQ(map.size(), std_map.size());
+  }
+};
+
+TEST_F(TestConcurrentMap, behavesLikeMap) {
+  s21::concurrent_map<int, string> map{{5, "Aer"}, {2, "Ignis"}, {9, "Lux"}};
+  std::map<int, string> reference{{5, "Aer"}, {2, "Ignis"}, {9, "Lux"}};
+  expectSame(map, reference);
+  EXPECT_TRUE(map.contains(9));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.find(2), "Ignis");
+  EXPECT_EQ(map.find(3), nullopt);
+  EXPECT_FALSE(map.insert_or_assign(2, "Aqua"));
+  EXPECT_TRUE(map.insert_or_assign(3, "Terra"));
+  size_t length = 0;
+  EXPECT_TRUE(map.visit(2, [&length](const string &v) { length = v.size(); }));
+  EXPECT_EQ(length, 4U);
+  EXPECT_FALSE(map.visit(4, [](const string &) { FAIL(); }));
+  EXPECT_EQ(map.erase(5), 1U);
+  EXPECT_EQ(map.erase(5), 0U);
+  reference = {{2, "Aqua"}, {3, "Terra"}, {9, "Lux"}};
+  expectSame(map, reference);
+
+  // обратный порядок сохраняется при слиянии частей
+  s21::concurrent_map<string, int, greater<string>> names(greater<string>{});
+  std::map<string, int, greater<string>> std_names;
+  std::mt19937 gen(21);
+  for (int i = 0; i < 3000; ++i) {
+    string key = to_string(gen() % 500);
+    if (i % 4 == 0) {
+      EXPECT_EQ(names.erase(key), std_names.erase(key));
+    } else {
+      EXPECT_EQ(names.insert_or_assign(key, i),
+                std_names.insert_or_assign(key, i).second);
+    }
+  }
+  expectSame(names, std_names);
+  names.clear();
+  EXPECT_TRUE(names.empty());
+}
+
+TEST_F(TestConcurrentMap, writersAndReadersInParallel) {
+  constexpr int kWriters = 4;
+  constexpr int kKeys = 4000;
+  s21::concurrent_map<int, int> map;
+  vector<thread> threads;
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&map, w] {
+      for (int key = w; key < kKeys; key += kWriters) {
+        map.insert_or_assign(key, -key);
+        map.insert_or_assign(key, key);
+        if (key % 10 == 0) map.erase(key);
+      }
+    });
+  }
+  // читатель видит либо старое, либо новое значение, но не мусор
+  threads.emplace_back([&map] {
+    for (int round = 0; round < 20; ++round) {
+      int previous = -1;
+      map.for_each([&previous](const pair<const int, int> &item) {
+        EXPECT_GT(item.first, previous);
+        EXPECT_TRUE(item.second == item.first || item.second == -item.first);
+        previous = item.first;
+      });
+      for (int key = 0; key < kKeys; key += 7) {
+        optional<int> value = map.find(key);
+        if (value) {
+          EXPECT_EQ(abs(*value), key);
+        }
+      }
+    }
+  });
+  for (thread &worker : threads) worker.join();
+
+  std::map<int, int> reference;
+  for (int key = 0; key < kKeys; ++key)
+    if (key % 10 != 0) reference[key] = key;
+  expectSame(map, reference);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_concurrent_stack.h"
+
+using namespace std;
+
+TEST(TestConcurrentStack, lifoOrderAndPopAll) {
+  s21::ConcurrentStack<string> stack;
+  EXPECT_TRUE(stack.empty());
+  string out;
+  EXPECT_FALSE(stack.try_pop(out));
+  stack.push("Aer");
+  string name = "Ignis";
+  stack.push(name);
+  stack.emplace(3U, 'x');
+  EXPECT_FALSE(stack.empty());
+  ASSERT_TRUE(stack.try_pop(out));
+  EXPECT_EQ(out, "xxx");
+
+  // освобождённые узлы переиспользуются
+  for (int i = 0; i < 1000; ++i) stack.push(to_string(i));
+  vector<string> all;
+  EXPECT_EQ(stack.pop_all(back_inserter(all)), 1002U);
+  EXPECT_TRUE(stack.empty());
+  ASSERT_EQ(all.size(), 1002U);
+  EXPECT_EQ(all.front(), "999");
+  EXPECT_EQ(all[1000], "Ignis");
+  EXPECT_EQ(all.back(), "Aer");
+  EXPECT_EQ(stack.pop_all(back_inserter(all)), 0U);
+
+  // оставшиеся элементы разрушает деструктор
+  s21::ConcurrentStack<unique_ptr<int>> owned;
+  owned.push(make_unique<int>(7));
+  owned.push(make_unique<int>(8));
+  unique_ptr<int> item;
+  ASSERT_TRUE(owned.try_pop(item));
+  EXPECT_EQ(*item, 8);
+}
+
+// Узлы постоянно снимаются и возвращаются разными потоками: без счётчика
+// в вершине CAS путал бы переиспользованный узел с прежним (ABA)
+TEST(TestConcurrentStack, threadsShareFreeList) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  s21::ConcurrentStack<int> stack;
+  vector<vector<int>> taken(kThreads);
+  vector<thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&stack, &taken, t] {
+      int value = 0;
+      for (int i = 0; i < kPerThread; ++i) {
+        stack.push(t * kPerThread + i);
+        if (i % 3 != 0 && stack.try_pop(value)) taken[t].push_back(value);
+        if (i % 1000 == 999) stack.pop_all(back_inserter(taken[t]));
+      }
+    });
+  }
+  for (thread &worker : threads) worker.join();
+  vector<int> all;
+  stack.pop_all(back_inserter(all));
+  for (const vector<int> &part : taken)
+    all.insert(all.end(), part.begin(), part.end());
+  sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), static_cast<size_t>(kThreads * kPerThread));
+  for (size_t i = 0; i < all.size(); ++i)
+    ASSERT_EQ(all[i], static_cast<int>(i));
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "../libraries/s21_flat_map.h"
+
+using namespace std;
+
+class TestFlatMap : public ::testing::Test {
+ public:
+  s21::flat_map<int, string> s21_flat{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}, {9, "Lux"}};
+  std::map<int, string> std_map{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}, {9, "Lux"}};
+
+  void expectSame() {
+    ASSERT_EQ(s21_flat.size(), std_map.size());
+    auto it = s21_flat.begin();
+    for (const auto &item : std_map) {
+      EXPECT_EQ(it->first, item.first);
+      EXPECT_EQ(it->second, item.second);
+      ++it;
+    }
+    EXPECT_EQ(it, s21_flat.end());
+  }
+};
+
+TEST_F(TestFlatMap, bulkConstructorSortsAndDeduplicates) {
+  expectSame();
+  vector<pair<int, int>> input;
+  for (int i = 0; i < 100; ++i) input.emplace_back((i * 37) % 50, i);
+  s21::flat_map<int, int> from_range(input.begin(), input.end());
+  std::map<int, int> std_range(input.begin(), input.end());
+  ASSERT_EQ(from_range.size(), std_range.size());
+  for (const auto &item : std_range)
+    EXPECT_EQ(from_range.at(item.first), item.second);
+}
+
+TEST_F(TestFlatMap, lookup) {
+  EXPECT_TRUE(s21_flat.contains(9));
+  EXPECT_FALSE(s21_flat.contains(3));
+  EXPECT_EQ(s21_flat.find(5)->second, "Aer");
+  EXPECT_EQ(s21_flat.find(3), s21_flat.end());
+  EXPECT_EQ(s21_flat.at(2), std_map.at(2));
+  EXPECT_THROW(s21_flat.at(3), std::out_of_range);
+  EXPECT_EQ(s21_flat.lower_bound(3)->first, 5);
+  EXPECT_EQ(s21_flat.upper_bound(5)->first, 9);
+  const auto &const_flat = s21_flat;
+  EXPECT_EQ(const_flat.find(1)->second, "Terra");
+  EXPECT_EQ(const_flat.at(9), "Lux");
+}
+
+TEST_F(TestFlatMap, insertAndOperatorAt) {
+  EXPECT_TRUE(s21_flat.insert({3, "Umbra"}).second);
+  EXPECT_FALSE(s21_flat.insert(3, "Ferrum").second);
+  std_map.insert({3, "Umbra"});
+  EXPECT_FALSE(s21_flat.insert_or_assign(1, "Ferrum").second);
+  std_map.insert_or_assign(1, "Ferrum");
+  EXPECT_EQ(s21_flat[7], std_map[7]);
+  s21_flat[0] = "Nox";
+  std_map[0] = "Nox";
+  s21_flat.begin()->second += "!";
+  std_map.begin()->second += "!";
+  expectSame();
+}
+
+TEST_F(TestFlatMap, erase) {
+  auto next = s21_flat.erase(s21_flat.find(2));
+  std_map.erase(2);
+  EXPECT_EQ(next->first, 5);
+  EXPECT_EQ(s21_flat.erase(9), 1U);
+  EXPECT_EQ(s21_flat.erase(9), 0U);
+  std_map.erase(9);
+  expectSame();
+  s21_flat.clear();
+  EXPECT_TRUE(s21_flat.empty());
+}
+
+TEST_F(TestFlatMap, mergeLeavesDuplicatesInSource) {
+  s21::flat_map<int, string> other{{0, "Nox"}, {5, "Ventus"}, {12, "Sol"}};
+  std::map<int, string> std_other{{0, "Nox"}, {5, "Ventus"}, {12, "Sol"}};
+  s21_flat.merge(other);
+  std_map.merge(std_other);
+  expectSame();
+  ASSERT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.begin()->second, "Ventus");
+}
+
+TEST_F(TestFlatMap, copyMoveSwap) {
+  s21::flat_map<int, string> copy(s21_flat);
+  s21::flat_map<int, string> moved(std::move(copy));
+  s21::flat_map<int, string> swapped;
+  swapped.swap(moved);
+  EXPECT_TRUE(moved.empty());
+  ASSERT_EQ(swapped.size(), s21_flat.size());
+  EXPECT_TRUE(std::equal(swapped.begin(), swapped.end(), s21_flat.begin()));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+
+#include "../libraries/s21_flat_set.h"
+
+using namespace std;
+
+class TestFlatSet : public ::testing::Test {
+ public:
+  s21::flat_set<int> s21_flat{10, 7, 9, 11, 12, 6, 6, 14, 11, 3, 9, 4};
+  std::set<int> std_set{10, 7, 9, 11, 12, 6, 6, 14, 11, 3, 9, 4};
+
+  void expectSame() {
+    ASSERT_EQ(s21_flat.size(), std_set.size());
+    EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_flat.begin()));
+  }
+};
+
+TEST_F(TestFlatSet, bulkConstructorSortsAndDeduplicates) {
+  expectSame();
+  s21::flat_set<string, greater<string>> names{"Ignis", "Terra", "Aer",
+                                               "Aqua", "Terra"};
+  set<string, greater<string>> std_names{"Ignis", "Terra", "Aer", "Aqua"};
+  ASSERT_EQ(names.size(), std_names.size());
+  EXPECT_TRUE(std::equal(std_names.begin(), std_names.end(), names.begin()));
+}
+
+TEST_F(TestFlatSet, insertFindErase) {
+  EXPECT_TRUE(s21_flat.insert(8).second);
+  EXPECT_FALSE(s21_flat.insert(8).second);
+  std_set.insert(8);
+  EXPECT_EQ(*s21_flat.find(8), 8);
+  EXPECT_EQ(s21_flat.find(5), s21_flat.end());
+  EXPECT_TRUE(s21_flat.contains(14));
+  EXPECT_EQ(*s21_flat.erase(s21_flat.find(9)), 10);
+  std_set.erase(9);
+  EXPECT_EQ(s21_flat.erase(3), 1U);
+  EXPECT_EQ(s21_flat.erase(3), 0U);
+  std_set.erase(3);
+  EXPECT_EQ(*s21_flat.lower_bound(5), *std_set.lower_bound(5));
+  EXPECT_EQ(*s21_flat.upper_bound(11), *std_set.upper_bound(11));
+  expectSame();
+}
+
+TEST_F(TestFlatSet, mergeLeavesDuplicatesInSource) {
+  s21::flat_set<int> other{1, 6, 13, 20};
+  std::set<int> std_other{1, 6, 13, 20};
+  s21_flat.merge(other);
+  std_set.merge(std_other);
+  expectSame();
+  ASSERT_EQ(other.size(), 1U);
+  EXPECT_EQ(*other.begin(), 6);
+}
@@ -253,6 +253,41 @@ TYPED_TEST_P(ContainersTest, List_operator) {
   }
 }
 
+TYPED_TEST_P(ContainersTest, List_move_and_assign) {
+  TypeParam v1, v2, v3;
+  if constexpr (std::is_same<TypeParam, std::string>::value) {
+    v1 = "Aer", v2 = "Ignis", v3 = "Terra";
+  } else {
+    v1 = 1.5, v2 = 2.5, v3 = 3.5;
+  }
+  s21::List<TypeParam> lst{v1, v2, v3};
+  auto *first = &lst.front();
+  // перемещение забирает узлы, а не копирует значения
+  s21::List<TypeParam> moved(std::move(lst));
+  EXPECT_EQ(&moved.front(), first);
+  EXPECT_TRUE(lst.empty());
+  EXPECT_EQ(lst.begin(), lst.end());
+  lst = std::move(moved);
+  EXPECT_EQ(&lst.front(), first);
+  EXPECT_EQ(lst.size(), 3U);
+
+  // копирующее присваивание пишет в уже выделенные узлы
+  s21::List<TypeParam> shorter{v3};
+  lst = shorter;
+  EXPECT_EQ(&lst.front(), first);
+  EXPECT_EQ(lst.size(), 1U);
+  EXPECT_EQ(lst.front(), v3);
+  s21::List<TypeParam> longer{v2, v1, v3, v2};
+  lst = longer;
+  EXPECT_EQ(&lst.front(), first);
+  std::list<TypeParam> expected{v2, v1, v3, v2};
+  EXPECT_EQ(lst.size(), expected.size());
+  auto it = expected.begin();
+  for (auto &value : lst) EXPECT_EQ(value, *it++);
+  lst = lst;
+  EXPECT_EQ(lst.size(), 4U);
+}
+
 TYPED_TEST_P(ContainersTest, List_iterator) {
   TypeParam v1, v2, v3, v4, v5;
 
@@ -474,7 +509,7 @@ REGISTER_TYPED_TEST_CASE_P(ContainersTest, List_empty_1, List_empty_2,
                            List_empty_3, List_empty_4, List_clear, List_edit,
                            List_unique, List_reverse, List_sort, List_swap,
                            List_splice, List_iterator, List_operator,
-                           List_constructors);
+                           List_constructors, List_move_and_assign);
 
 // Instantiate the typed test case with the registered types
 INSTANTIATE_TYPED_TEST_CASE_P(TypedTests, ContainersTest, Types);
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "../libraries/s21_map.h"
 
 using namespace std;
@@ -217,3 +221,149 @@ TEST_F(TestMap, emplaceMethod) {
     it++;
   }
 }
+TEST_F(TestMap, reserveMethod) {
+  s21::map<int, int> test;
+  test.reserve(64);
+  for (int i = 0; i < 64; ++i) test.insert(i, i * 2);
+  EXPECT_EQ(test.size(), 64U);
+  // все узлы лежат в одном слябе
+  auto *low = test.get_current(test.begin());
+  auto *high = low;
+  for (auto it = test.begin(); it != test.end(); ++it) {
+    low = std::min(low, test.get_current(it));
+    high = std::max(high, test.get_current(it));
+  }
+  EXPECT_EQ(high - low, 63);
+  EXPECT_EQ(test.at(63), 126);
+}
+TEST_F(TestMap, erasedNodeIsReused) {
+  auto pos = s21_map_int_1.begin();
+  ++pos;
+  auto *node = s21_map_int_1.get_current(pos);
+  s21_map_int_1.erase(pos);
+  s21_map_int_1.insert(100, 100);
+  EXPECT_EQ(&s21_map_int_1.at(100), &node->data.second);
+  EXPECT_EQ(s21_map_int_1.size(), std_map_int_1.size());
+}
+TEST_F(TestMap, rangeConstructorAndAssignSorted) {
+  vector<pair<int, int>> input;
+  for (int i = 0; i < 200; ++i) input.emplace_back((i * 37) % 101, i);
+  s21::map<int, int> test(input.begin(), input.end());
+  std::map<int, int> expected(input.begin(), input.end());
+  ASSERT_EQ(test.size(), expected.size());
+  for (auto &item : expected) EXPECT_EQ(test.at(item.first), item.second);
+
+  s21_map_int_1.assign_sorted(expected.begin(), expected.end());
+  ASSERT_EQ(s21_map_int_1.size(), expected.size());
+  auto it = expected.begin();
+  for (auto &item : s21_map_int_1) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  EXPECT_TRUE(s21_map_int_1.insert(500, 1).second);
+  EXPECT_FALSE(s21_map_int_1.insert(50, 1).second);
+}
+TEST_F(TestMap, transparentLookup) {
+  s21::map<string, int, std::less<>> test{
+      {"Aer", 1}, {"Ignis", 2}, {"Terra", 3}, {"Aqua", 4}};
+  string_view key = "Ignis";
+  EXPECT_EQ(test.find(key)->second, 2);
+  EXPECT_EQ(test.find("Lux"), test.end());
+  EXPECT_TRUE(test.contains("Terra"));
+  EXPECT_FALSE(test.contains(string_view("Terr")));
+  EXPECT_EQ(test.count(key), 1U);
+  EXPECT_EQ(test.lower_bound(string_view("B"))->first, "Ignis");
+  EXPECT_EQ(test.upper_bound("Aqua")->first, "Ignis");
+  EXPECT_EQ(test.upper_bound("Terra"), test.end());
+}
+TEST_F(TestMap, extractAndInsertNodeHandle) {
+  s21::map<int, string> active;
+  auto *pending = new s21::map<int, string>(s21_map_int_str_1);
+  auto *node = pending->get_current(pending->find(2));
+  auto handle = pending->extract(2);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 2);
+  EXPECT_EQ(pending->size(), 2U);
+  EXPECT_FALSE(pending->contains(2));
+  // узел переживает исходное дерево
+  delete pending;
+  handle.mapped() = "Ferrum";
+  auto result = active.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(handle.empty());
+  EXPECT_EQ(active.get_current(result.position), node);
+  EXPECT_EQ(active.at(2), "Ferrum");
+
+  s21::map<int, string> other{{2, "Nox"}, {7, "Lux"}};
+  auto taken = other.extract(other.find(2));
+  auto failed = active.insert(std::move(taken));
+  EXPECT_FALSE(failed.inserted);
+  EXPECT_EQ(failed.node.mapped(), "Nox");
+  EXPECT_EQ(failed.position->second, "Ferrum");
+  EXPECT_TRUE(other.extract(100).empty());
+}
+TEST_F(TestMap, mergeRelinksNodes) {
+  s21_map_int_2.insert(10, -1);
+  std_map_int_2.insert({10, -1});
+  auto *moved = s21_map_int_2.get_current(s21_map_int_2.find(111));
+  s21_map_int_1.merge(s21_map_int_2);
+  std_map_int_1.merge(std_map_int_2);
+  EXPECT_EQ(s21_map_int_1.get_current(s21_map_int_1.find(111)), moved);
+  EXPECT_EQ(s21_map_int_2.size(), std_map_int_2.size());
+  EXPECT_EQ(s21_map_int_2.at(10), -1);
+  EXPECT_EQ(s21_map_int_1.at(10), 10);
+  s21_map_int_2 = s21::map<int, int>();
+  auto it = std_map_int_1.begin();
+  for (auto &i : s21_map_int_1) {
+    EXPECT_EQ(i.first, it->first);
+    ++it;
+  }
+  EXPECT_EQ(s21_map_int_1.size(), std_map_int_1.size());
+}
+TEST_F(TestMap, hintedAppendSkipsDescent) {
+  static long compares;
+  struct CountingLess {
+    bool operator()(int a, int b) const {
+      ++compares;
+      return a < b;
+    }
+  };
+  s21::map<int, int, CountingLess> test;
+  compares = 0;
+  for (int i = 0; i < 1000; ++i) test.emplace_hint(test.end(), i, i * 2);
+  EXPECT_LE(compares, 1000);
+  auto hint = test.begin();
+  for (int i = 1000; i < 2000; ++i)
+    hint = test.insert(hint, std::pair<const int, int>(i, i));
+  EXPECT_EQ(test.size(), 2000U);
+  int expected = 0;
+  for (auto &item : test) EXPECT_EQ(item.first, expected++);
+
+  // неверный hint стоит обычного спуска, повтор не вставляется
+  auto pos = test.emplace_hint(test.begin(), 1500, -1);
+  EXPECT_EQ(pos->second, 1500);
+  test.insert(test.find(1999), std::pair<const int, int>(-5, 0));
+  test.emplace_hint(test.find(10), 2500, 0);
+  EXPECT_EQ(test.begin()->first, -5);
+  EXPECT_EQ(test.upper_bound(1999)->first, 2500);
+  EXPECT_EQ(test.size(), 2002U);
+}
+TEST_F(TestMap, tryEmplaceAndSubscript) {
+  auto result = s21_map_str_int_1.try_emplace("aer", 100);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, 5);
+  result = s21_map_str_int_1.try_emplace("lux", 7);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(s21_map_str_int_1.at("lux"), 7);
+  s21_map_str_int_1["nox"] += 3;
+  s21_map_str_int_1["aer"] += 3;
+  EXPECT_EQ(s21_map_str_int_1.at("nox"), 3);
+  EXPECT_EQ(s21_map_str_int_1.at("aer"), 8);
+  EXPECT_EQ(s21_map_str_int_1.size(), 5U);
+
+  s21::map<int, string> strings;
+  EXPECT_EQ(strings.try_emplace(1, 3U, 'x').first->second, "xxx");
+  EXPECT_FALSE(strings.try_emplace(1, "y").second);
+  EXPECT_EQ(strings[1], "xxx");
+}
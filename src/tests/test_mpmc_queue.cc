@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_mpmc_queue.h"
+
+using namespace std;
+
+TEST(TestMpmcQueue, singleThreadKeepsOrder) {
+  s21::MpmcQueue<string, 4> queue;
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_TRUE(queue.empty());
+  string out;
+  EXPECT_FALSE(queue.try_pop(out));
+  for (int round = 0; round < 3; ++round) {
+    EXPECT_TRUE(queue.try_push("Aer"));
+    string name = "Ignis";
+    EXPECT_TRUE(queue.try_push(name));
+    EXPECT_TRUE(queue.try_emplace(3U, 'x'));
+    queue.push("Terra");
+    EXPECT_FALSE(queue.try_push("Nox"));
+    EXPECT_EQ(queue.size(), 4U);
+    for (const char *expected : {"Aer", "Ignis", "xxx"}) {
+      ASSERT_TRUE(queue.try_pop(out));
+      EXPECT_EQ(out, expected);
+    }
+    queue.pop(out);
+    EXPECT_EQ(out, "Terra");
+  }
+  EXPECT_TRUE(queue.empty());
+  // оставшиеся элементы разрушает деструктор
+  queue.emplace(100U, 'a');
+  auto owned = make_unique<s21::MpmcQueue<unique_ptr<int>, 2>>();
+  owned->push(make_unique<int>(7));
+  unique_ptr<int> item;
+  owned->pop(item);
+  EXPECT_EQ(*item, 7);
+}
+
+// блокирующие push и pop засыпают на полной и пустой очереди и
+// просыпаются, когда другая сторона освобождает место
+TEST(TestMpmcQueue, manyProducersAndConsumers) {
+  constexpr int kProducers = 3;
+  constexpr int kConsumers = 3;
+  constexpr int kPerProducer = 20000;
+  s21::MpmcQueue<int, 16> queue;
+  vector<vector<int>> received(kConsumers);
+  vector<thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        int value = p * kPerProducer + i;
+        if (i % 2 == 0) {
+          queue.push(value);
+        } else {
+          while (!queue.try_push(value)) this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&queue, &received, c] {
+      int value = 0;
+      for (int i = 0; i < kProducers * kPerProducer / kConsumers; ++i) {
+        queue.pop(value);
+        received[c].push_back(value);
+      }
+    });
+  }
+  for (thread &worker : threads) worker.join();
+  EXPECT_TRUE(queue.empty());
+
+  vector<int> all;
+  for (const vector<int> &part : received) {
+    // элементы одного производителя приходят в порядке отправки
+    vector<int> last(kProducers, -1);
+    for (int value : part) {
+      EXPECT_GT(value, last[value / kPerProducer]);
+      last[value / kPerProducer] = value;
+    }
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), static_cast<size_t>(kProducers * kPerProducer));
+  for (size_t i = 0; i < all.size(); ++i)
+    ASSERT_EQ(all[i], static_cast<int>(i));
+}
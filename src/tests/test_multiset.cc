@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "../libraries/s21_multiset.h"
 
 using namespace std;
@@ -148,12 +152,14 @@ TEST_F(TestMultiset, mergeMethd) {
     ++it;
   }
 }
-// TEST_F(TestMultiset, findMethod) {
-//   EXPECT_EQ(s21_mset_int_2.find(11)->first, 0);
-//   EXPECT_EQ(s21_mset_str_3.find("Terra")->first,
-//   *std_mset_str_3.find("Terra")); EXPECT_EQ(s21_mset_int_2.find(333)->first,
-//   *std_mset_int_2.find(333));
-// }
+TEST_F(TestMultiset, findMethod) {
+  EXPECT_TRUE(s21_mset_int_2.find(11) == s21_mset_int_2.end());
+  EXPECT_EQ(s21_mset_str_3.find("Terra")->first, *std_mset_str_3.find("Terra"));
+  EXPECT_EQ(s21_mset_int_2.find(333)->first, *std_mset_int_2.find(333));
+  auto first = s21_mset_int_1.find(11);
+  --first;
+  EXPECT_EQ(first->first, 10);
+}
 TEST_F(TestMultiset, containsMethod) {
   EXPECT_TRUE(s21_mset_str_3.contains("Ignis"));
   EXPECT_TRUE(s21_mset_str_3.contains("Terra"));
@@ -197,7 +203,8 @@ TEST_F(TestMultiset, upper_bMethod) {
   auto test_stl_2 = std_mset_int_1.upper_bound(13);
   auto test_s21_3 = s21_mset_int_1.upper_bound(1);
   auto test_stl_3 = std_mset_int_1.upper_bound(1);
-  // EXPECT_EQ(test_s21->first, 0);
+  EXPECT_TRUE(test_s21 == s21_mset_int_1.end());
+  EXPECT_TRUE(s21_mset_int_1.lower_bound(15) == s21_mset_int_1.end());
   EXPECT_EQ(test_s21_1->first, *test_stl_1);
   EXPECT_EQ(test_s21_2->first, *test_stl_2);
   EXPECT_EQ(test_s21_3->first, *test_stl_3);
@@ -211,4 +218,92 @@ TEST_F(TestMultiset, emplaceMethod) {
   EXPECT_EQ(s21_mset_str_3.find("Vault")->first, "Vault");
   EXPECT_EQ(s21_mset_str_3.find("Univers")->first, "Univers");
   EXPECT_EQ(s21_mset_str_3.find("Progress")->first, "Progress");
-}
\ No newline at end of file
+}
+
+TEST(TestMultisetBalance, sortedDuplicates) {
+  s21::multiset<int> test;
+  std::multiset<int> stl;
+  for (int i = 0; i < 2048; ++i) {
+    test.insert(i / 4);
+    stl.insert(i / 4);
+  }
+  for (int i = 0; i < 512; ++i) {
+    auto pos = test.begin();
+    for (int j = 0; j < i; ++j) ++pos;
+    test.erase(pos);
+    stl.erase(std::next(stl.begin(), i));
+  }
+  EXPECT_EQ(test.size(), stl.size());
+  EXPECT_EQ(test.count(100), stl.count(100));
+  auto it = stl.begin();
+  for (auto &i : test) {
+    EXPECT_EQ(i.first, *it);
+    ++it;
+  }
+}
+TEST_F(TestMultiset, rangeConstructorKeepsDuplicates) {
+  std::vector<int> keys;
+  for (int i = 0; i < 400; ++i) keys.push_back(i / 3);
+  s21::multiset<int> sorted(keys.begin(), keys.end());
+  s21::multiset<int> reversed(keys.rbegin(), keys.rend());
+  s21::multiset<int> assigned;
+  assigned.assign_sorted(keys.begin(), keys.end());
+  for (auto *test : {&sorted, &reversed, &assigned}) {
+    EXPECT_EQ(test->size(), keys.size());
+    EXPECT_EQ(test->count(50), 3U);
+    auto it = keys.begin();
+    for (auto &i : *test) EXPECT_EQ(i.first, *it++);
+  }
+}
+TEST_F(TestMultiset, customComparatorAndTransparentLookup) {
+  s21::multiset<string, std::greater<>> test{"Aer", "Lux", "Aer", "Nox"};
+  std::multiset<string, std::greater<>> stl{"Aer", "Lux", "Aer", "Nox"};
+  auto it = stl.begin();
+  for (auto &i : test) EXPECT_EQ(i.first, *it++);
+  string_view key = "Aer";
+  EXPECT_EQ(test.count(key), 2U);
+  auto range = test.equal_range(key);
+  EXPECT_EQ(range.first->first, "Aer");
+  EXPECT_EQ(range.second, test.end());
+  EXPECT_EQ(test.lower_bound("M")->first, "Lux");
+  EXPECT_EQ(test.find(string_view("Lux")), test.lower_bound("Lux"));
+  EXPECT_FALSE(test.contains("Umbra"));
+  s21::multiset<string, std::greater<>> copy(test);
+  EXPECT_EQ(copy.begin()->first, "Nox");
+}
+TEST_F(TestMultiset, nodeHandlesMoveBetweenSets) {
+  s21::multiset<int> target{1, 2};
+  {
+    s21::multiset<int> source{2, 3, 3};
+    auto handle = source.extract(3);
+    EXPECT_EQ(handle.value(), 3);
+    target.insert(std::move(handle));
+    target.insert(source.extract(source.begin()));
+    target.merge(source);
+    EXPECT_TRUE(source.empty());
+  }
+  std::multiset<int> expected{1, 2, 2, 3, 3};
+  EXPECT_EQ(target.size(), expected.size());
+  auto it = expected.begin();
+  for (auto &i : target) EXPECT_EQ(i.first, *it++);
+  target.erase(target.find(3));
+  target.insert(5);
+  EXPECT_EQ(target.count(3), 1U);
+}
+TEST_F(TestMultiset, hintedInsertKeepsOrder) {
+  s21::multiset<int> test;
+  std::multiset<int> stl;
+  auto hint = test.end();
+  for (int i = 0; i < 300; ++i) {
+    hint = test.emplace_hint(hint, i / 3);
+    stl.insert(i / 3);
+  }
+  test.insert(test.begin(), 50);
+  test.insert(test.end(), -1);
+  test.emplace_hint(test.find(10), 10);
+  stl.insert({50, -1, 10});
+  EXPECT_EQ(test.size(), stl.size());
+  EXPECT_EQ(test.count(10), 4U);
+  auto it = stl.begin();
+  for (auto &i : test) EXPECT_EQ(i.first, *it++);
+}
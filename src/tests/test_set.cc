@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <vector>
+
 #include "../libraries/s21_set.h"
 
 using namespace std;
@@ -138,7 +141,7 @@ TEST_F(TestSet, mergeMethd) {
   }
 }
 TEST_F(TestSet, findMethod) {
-  // EXPECT_EQ(s21_set_int_2.find(11)->first, 0);
+  EXPECT_TRUE(s21_set_int_2.find(11) == s21_set_int_2.end());
   EXPECT_EQ(s21_set_str_3.find("Terra")->first, *std_set_str_3.find("Terra"));
   EXPECT_EQ(s21_set_int_2.find(333)->first, *std_set_int_2.find(333));
 }
@@ -157,3 +160,131 @@ TEST_F(TestSet, emplaceMethod) {
   EXPECT_EQ(s21_set_str_3.find("Univers")->first, "Univers");
   EXPECT_EQ(s21_set_str_3.find("Progress")->first, "Progress");
 }
+
+template <class Key>
+class InspectSet : public s21::set<Key> {
+ public:
+  using tnode = typename s21::set<Key>::RBT::tnode;
+  // возвращает чёрную высоту или -1, если свойства дерева нарушены
+  int blackHeight(tnode *node) const {
+    if (node == nullptr) return 1;
+    if (node->color == s21::NodeColor::kRed &&
+        ((node->left && node->left->color == s21::NodeColor::kRed) ||
+         (node->right && node->right->color == s21::NodeColor::kRed)))
+      return -1;
+    if ((node->left && node->left->parent != node) ||
+        (node->right && node->right->parent != node))
+      return -1;
+    int left = blackHeight(node->left);
+    int right = blackHeight(node->right);
+    if (left < 0 || left != right) return -1;
+    return left + (node->color == s21::NodeColor::kBlack ? 1 : 0);
+  }
+  bool isValid() const {
+    return (this->root == nullptr ||
+            this->root->color == s21::NodeColor::kBlack) &&
+           blackHeight(this->root) > 0;
+  }
+  int height(tnode *node) const {
+    if (node == nullptr) return 0;
+    return 1 + std::max(height(node->left), height(node->right));
+  }
+  int height() const { return height(this->root); }
+};
+
+TEST(TestSetBalance, sortedInsert) {
+  InspectSet<int> test;
+  std::set<int> stl;
+  for (int i = 0; i < 4096; ++i) {
+    test.insert(i);
+    stl.insert(i);
+  }
+  EXPECT_TRUE(test.isValid());
+  EXPECT_LE(test.height(), 24);
+  EXPECT_EQ(test.size(), stl.size());
+  auto it = stl.begin();
+  for (auto &i : test) {
+    EXPECT_EQ(i.first, *it);
+    ++it;
+  }
+}
+TEST(TestSetBalance, eraseKeepsBalance) {
+  InspectSet<int> test;
+  std::set<int> stl;
+  for (int i = 4096; i > 0; --i) {
+    test.insert((i * 37) % 4096);
+    stl.insert((i * 37) % 4096);
+  }
+  for (int i = 0; i < 4096; i += 3) {
+    auto pos = test.begin();
+    for (int j = 0; j < i / 3; ++j) ++pos;
+    test.erase(pos);
+    stl.erase(std::next(stl.begin(), i / 3));
+    ASSERT_TRUE(test.isValid());
+  }
+  EXPECT_EQ(test.size(), stl.size());
+  auto it = stl.begin();
+  for (auto &i : test) {
+    EXPECT_EQ(i.first, *it);
+    ++it;
+  }
+  s21::set<int> copy(test);
+  EXPECT_EQ(copy.size(), stl.size());
+  it = stl.begin();
+  for (auto &i : copy) {
+    EXPECT_EQ(i.first, *it);
+    ++it;
+  }
+}
+TEST(TestSetBalance, sortedRangeBuildsBalancedTree) {
+  for (int n : {0, 1, 2, 3, 7, 8, 1000, 4095}) {
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    InspectSet<int> test;
+    test.insert(-1);
+    test.assign_sorted(keys.begin(), keys.end());
+    ASSERT_TRUE(test.isValid());
+    ASSERT_EQ(test.size(), keys.size());
+    int height = 0;
+    while ((1 << height) <= n) ++height;
+    EXPECT_EQ(test.height(), height);
+    auto it = keys.begin();
+    for (auto &i : test) EXPECT_EQ(i.first, *it++);
+    // после сборки дерево продолжает балансироваться как обычно
+    for (int i = 0; i < 100; ++i) test.insert(n + i);
+    for (int i = 0; i < 50; ++i) test.erase(test.begin());
+    ASSERT_TRUE(test.isValid());
+    EXPECT_EQ(test.size(), keys.size() + 50U);
+  }
+}
+TEST(TestSetBalance, rangeConstructorSortsAndDeduplicates) {
+  std::vector<int> keys;
+  for (int i = 0; i < 300; ++i) keys.push_back((i * 37) % 101);
+  s21::set<int> test(keys.begin(), keys.end());
+  std::set<int> stl(keys.begin(), keys.end());
+  EXPECT_EQ(test.size(), stl.size());
+  auto it = stl.begin();
+  for (auto &i : test) {
+    EXPECT_EQ(i.first, *it);
+    ++it;
+  }
+}
+TEST(TestSetBalance, copyPreservesShapeAndColors) {
+  InspectSet<int> test;
+  for (int i = 0; i < 20000; ++i) test.insert((i * 7919) % 20000);
+  for (int i = 0; i < 20000; i += 7) test.erase(test.find(i));
+  InspectSet<int> copy(test);
+  ASSERT_TRUE(copy.isValid());
+  EXPECT_EQ(copy.height(), test.height());
+  EXPECT_EQ(copy.size(), test.size());
+  auto it = test.begin();
+  for (auto &i : copy) {
+    EXPECT_EQ(i.first, it->first);
+    EXPECT_EQ(copy.get_current(copy.find(i.first))->color,
+              test.get_current(it)->color);
+    ++it;
+  }
+  copy.clear();
+  EXPECT_EQ(copy.size(), 0U);
+  EXPECT_TRUE(copy.empty());
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_snapshot_map.h"
+
+using namespace std;
+
+class TestSnapshotMap : public ::testing::Test {
+ public:
+  template <class Snapshot, class StdMap>
+  static void expectSame(const Snapshot &view, const StdMap &std_map) {
+    ASSERT_EQ(view.size(), std_map.size());
+    vector<pair<int, string>> items;
+    view.for_each([&items](const auto &item) { items.push_back(item); });
+    vector<pair<int, string>> expected(std_map.begin(), std_map.end());
+    EXPECT_EQ(items, expected);
+  }
+};
+
+TEST_F(TestSnapshotMap, snapshotsKeepTheirVersion) {
+  s21::snapshot_map<int, string> map{{5, "Aer"}, {2, "Ignis"}, {9, "Lux"}};
+  std::map<int, string> reference{{5, "Aer"}, {2, "Ignis"}, {9, "Lux"}};
+  auto before = map.get_snapshot();
+  EXPECT_TRUE(map.insert_or_assign(3, "Terra"));
+  EXPECT_FALSE(map.insert_or_assign(5, "Aqua"));
+  EXPECT_EQ(map.erase(2), 1U);
+  EXPECT_EQ(map.erase(2), 0U);
+  // старая версия не видит изменений
+  expectSame(before, reference);
+  EXPECT_EQ(before.at(5), "Aer");
+  EXPECT_THROW(before.at(3), std::out_of_range);
+
+  reference = {{3, "Terra"}, {5, "Aqua"}, {9, "Lux"}};
+  auto after = map.get_snapshot();
+  expectSame(after, reference);
+  EXPECT_EQ(*after.find(5), "Aqua");
+  EXPECT_EQ(after.find(2), nullptr);
+  EXPECT_EQ(map.find(9), "Lux");
+  EXPECT_EQ(map.find(4), nullopt);
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_EQ(map.size(), 3U);
+
+  before = std::move(after);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  expectSame(before, reference);
+}
+
+TEST_F(TestSnapshotMap, randomUpdatesMatchStd) {
+  s21::snapshot_map<int, string> map;
+  std::map<int, string> reference;
+  std::mt19937 gen(21);
+  vector<pair<decltype(map.get_snapshot()), std::map<int, string>>> history;
+  for (int i = 0; i < 6000; ++i) {
+    int key = static_cast<int>(gen() % 800);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(map.insert_or_assign(key, to_string(i)),
+                reference.insert_or_assign(key, to_string(i)).second);
+    }
+    if (i % 1000 == 0) history.emplace_back(map.get_snapshot(), reference);
+  }
+  expectSame(map.get_snapshot(), reference);
+  // версии делят неизменённые поддеревья, но каждая видит своё
+  for (const auto &[view, expected] : history) expectSame(view, expected);
+}
+
+// считает живые значения, то есть узлы всех версий
+struct Counted {
+  Counted(int v) : value(v) { ++live; }
+  Counted(const Counted &other) : value(other.value) { ++live; }
+  ~Counted() { --live; }
+  int value;
+  static int live;
+};
+int Counted::live = 0;
+
+TEST_F(TestSnapshotMap, updatesCopyOnlyThePath) {
+  {
+    s21::snapshot_map<int, Counted> map;
+    for (int key = 0; key < 1000; ++key) map.insert_or_assign(key, key);
+    // версии без читателей освобождены
+    EXPECT_EQ(Counted::live, 1000);
+    auto view = map.get_snapshot();
+    map.insert_or_assign(500, -1);
+    map.erase(10);
+    // обе версии делят всё, кроме двух путей от корня
+    EXPECT_GT(Counted::live, 1000);
+    EXPECT_LE(Counted::live, 1000 + 2 * 3 * 15);
+    EXPECT_EQ(view.at(500).value, 500);
+    EXPECT_EQ(map.find(500)->value, -1);
+    view = decltype(view)();
+    map.insert_or_assign(0, 0);
+    EXPECT_EQ(Counted::live, 999);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST_F(TestSnapshotMap, readersDoNotSeeHalfDoneUpdates) {
+  constexpr int kKeys = 64;
+  s21::snapshot_map<int, int> map;
+  for (int key = 0; key < kKeys; ++key) map.insert_or_assign(key, 0);
+  vector<thread> readers;
+  for (int r = 0; r < 3; ++r) {
+    readers.emplace_back([&map] {
+      for (int round = 0; round < 2000; ++round) {
+        // писатель меняет все ключи одной версией за другой: в снимке
+        // значения могут расти от ключа к ключу, но не больше чем на 1
+        auto view = map.get_snapshot();
+        int first = *view.find(0);
+        int last = *view.find(kKeys - 1);
+        EXPECT_TRUE(last == first || last == first - 1);
+        EXPECT_EQ(view.size(), static_cast<size_t>(kKeys));
+      }
+    });
+  }
+  for (int value = 1; value <= 300; ++value)
+    for (int key = 0; key < kKeys; ++key) map.insert_or_assign(key, value);
+  for (thread &reader : readers) reader.join();
+  EXPECT_EQ(map.find(kKeys - 1), 300);
+}
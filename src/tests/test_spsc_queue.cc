@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../libraries/s21_spsc_queue.h"
+
+using namespace std;
+
+TEST(TestSpscQueue, pushPopWrapsAround) {
+  s21::SpscQueue<string, 4> queue;
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_TRUE(queue.empty());
+  string out;
+  EXPECT_FALSE(queue.try_pop(out));
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(to_string(i)));
+    EXPECT_FALSE(queue.try_push("Nox"));
+    EXPECT_EQ(queue.size(), 4U);
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_TRUE(queue.try_pop(out));
+      EXPECT_EQ(out, to_string(i));
+    }
+    EXPECT_TRUE(queue.try_emplace(3U, 'x'));
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out, "3");
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out, "xxx");
+  }
+  EXPECT_TRUE(queue.empty());
+  // оставшиеся элементы разрушает деструктор
+  EXPECT_TRUE(queue.try_push(string(100, 'a')));
+}
+
+TEST(TestSpscQueue, batchesStopAtCapacity) {
+  s21::SpscQueue<unique_ptr<int>, 8> queue;
+  vector<int> items{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  vector<unique_ptr<int>> source;
+  for (int item : items) source.push_back(make_unique<int>(item));
+  EXPECT_EQ(queue.push_n(make_move_iterator(source.begin()), 10U), 8U);
+  EXPECT_NE(source[8], nullptr);
+  EXPECT_EQ(source[7], nullptr);
+
+  vector<unique_ptr<int>> out(10);
+  EXPECT_EQ(queue.pop_n(out.begin(), 5U), 5U);
+  EXPECT_EQ(queue.push_n(make_move_iterator(source.begin() + 8), 2U), 2U);
+  EXPECT_EQ(queue.pop_n(out.begin() + 5, 10U), 5U);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(*out[i], items[i]);
+  EXPECT_EQ(queue.pop_n(out.begin(), 3U), 0U);
+}
+
+TEST(TestSpscQueue, producerAndConsumerThreads) {
+  constexpr int kItems = 200000;
+  s21::SpscQueue<int, 64> queue;
+  thread producer([&queue] {
+    int batch[16];
+    for (int next = 0; next < kItems;) {
+      if (next % 3 == 0) {
+        if (queue.try_push(next)) {
+          ++next;
+        } else {
+          this_thread::yield();
+        }
+        continue;
+      }
+      int count = 0;
+      for (; count < 16 && next + count < kItems; ++count)
+        batch[count] = next + count;
+      int pushed = static_cast<int>(queue.push_n(batch, count));
+      if (pushed == 0) this_thread::yield();
+      next += pushed;
+    }
+  });
+  vector<int> received;
+  int buffer[32];
+  while (received.size() < static_cast<size_t>(kItems)) {
+    size_t got = queue.pop_n(buffer, 32U);
+    if (got == 0U) this_thread::yield();
+    received.insert(received.end(), buffer, buffer + got);
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < kItems; ++i) ASSERT_EQ(received[i], i);
+}
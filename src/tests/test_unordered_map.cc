@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "../libraries/s21_unordered_map.h"
+
+using namespace std;
+
+// все ключи в одной цепочке: проверяет пробирование по группам
+struct CollidingHash {
+  size_t operator()(int) const { return 42U; }
+};
+
+class TestUnorderedMap : public ::testing::Test {
+ public:
+  s21::unordered_map<int, string> s21_map{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}};
+  std::unordered_map<int, string> std_map{
+      {5, "Aer"}, {2, "Ignis"}, {1, "Terra"}, {2, "Aqua"}};
+
+  template <class Map, class StdMap>
+  static void expectSame(Map &map, StdMap &std_map) {
+    ASSERT_EQ(map.size(), std_map.size());
+    size_t visited = 0;
+    for (auto &item : map) {
+      EXPECT_EQ(std_map.at(item.first), item.second);
+      ++visited;
+    }
+    EXPECT_EQ(visited, std_map.size());
+  }
+};
+
+TEST_F(TestUnorderedMap, lookup) {
+  expectSame(s21_map, std_map);
+  EXPECT_TRUE(s21_map.contains(5));
+  EXPECT_FALSE(s21_map.contains(3));
+  EXPECT_EQ(s21_map.find(2)->second, "Ignis");
+  EXPECT_EQ(s21_map.find(3), s21_map.end());
+  EXPECT_EQ(s21_map.count(1), 1U);
+  EXPECT_EQ(s21_map.at(1), "Terra");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  const auto &const_map = s21_map;
+  EXPECT_EQ(const_map.at(5), "Aer");
+  EXPECT_EQ(const_map.find(1)->second, "Terra");
+}
+
+TEST_F(TestUnorderedMap, insertAndOperatorAt) {
+  EXPECT_TRUE(s21_map.insert({3, "Umbra"}).second);
+  EXPECT_FALSE(s21_map.insert(3, "Ferrum").second);
+  std_map.insert({3, "Umbra"});
+  EXPECT_FALSE(s21_map.insert_or_assign(1, "Ferrum").second);
+  EXPECT_TRUE(s21_map.insert_or_assign(8, "Sol").second);
+  std_map.insert_or_assign(1, "Ferrum");
+  std_map.insert_or_assign(8, "Sol");
+  EXPECT_EQ(s21_map[7], std_map[7]);
+  s21_map[0] = "Nox";
+  std_map[0] = "Nox";
+  EXPECT_TRUE(s21_map.emplace(9, "Lux").second);
+  std_map.emplace(9, "Lux");
+  expectSame(s21_map, std_map);
+}
+
+TEST_F(TestUnorderedMap, eraseAndMerge) {
+  EXPECT_EQ(s21_map.erase(2), 1U);
+  EXPECT_EQ(s21_map.erase(2), 0U);
+  std_map.erase(2);
+  s21_map.erase(s21_map.find(5));
+  std_map.erase(5);
+  expectSame(s21_map, std_map);
+
+  s21::unordered_map<int, string> other{{1, "Nox"}, {4, "Ventus"}};
+  std::unordered_map<int, string> std_other{{1, "Nox"}, {4, "Ventus"}};
+  s21_map.merge(other);
+  std_map.merge(std_other);
+  expectSame(s21_map, std_map);
+  expectSame(other, std_other);
+}
+
+TEST_F(TestUnorderedMap, randomOperationsMatchStd) {
+  s21::unordered_map<int, int> map;
+  std::unordered_map<int, int> reference;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int i = 0; i < 20000; ++i) {
+    int k = key(gen);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(map.erase(k), reference.erase(k));
+    } else {
+      map[k] += i;
+      reference[k] += i;
+    }
+  }
+  expectSame(map, reference);
+  for (int k = 0; k <= 2000; ++k)
+    EXPECT_EQ(map.contains(k), reference.count(k) == 1U);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+}
+
+TEST_F(TestUnorderedMap, collidingKeysAndRehash) {
+  s21::unordered_map<int, int, CollidingHash> map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i * i);
+  for (int i = 0; i < 100; i += 2) map.erase(i);
+  ASSERT_EQ(map.size(), 50U);
+  for (int i = 1; i < 100; i += 2) EXPECT_EQ(map.at(i), i * i);
+  EXPECT_FALSE(map.contains(50));
+
+  s21::unordered_map<int, int> sized;
+  sized.reserve(1000);
+  size_t buckets = sized.bucket_count();
+  EXPECT_GE(buckets * sized.max_load_factor(), 1000U);
+  for (int i = 0; i < 1000; ++i) sized.insert(i, i);
+  EXPECT_EQ(sized.bucket_count(), buckets);
+  sized.max_load_factor(0.5F);
+  EXPECT_LE(sized.load_factor(), 0.5F);
+  sized.rehash(0);
+  EXPECT_EQ(sized.size(), 1000U);
+  sized.clear();
+  sized.rehash(0);
+  EXPECT_EQ(sized.bucket_count(), 0U);
+  EXPECT_EQ(sized.begin(), sized.end());
+}
+
+TEST_F(TestUnorderedMap, copyMoveSwap) {
+  s21::unordered_map<int, string> copy(s21_map);
+  expectSame(copy, std_map);
+  s21::unordered_map<int, string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  s21::unordered_map<int, string> swapped;
+  swapped.swap(moved);
+  expectSame(swapped, std_map);
+}
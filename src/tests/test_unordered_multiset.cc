@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "../libraries/s21_unordered_multiset.h"
+
+using namespace std;
+
+class TestUnorderedMultiset : public ::testing::Test {
+ public:
+  s21::unordered_multiset<int> s21_set{5, 2, 1, 2, 5, 2};
+  std::unordered_multiset<int> std_set{5, 2, 1, 2, 5, 2};
+
+  template <class Set, class StdSet>
+  static void expectSame(const Set &set, const StdSet &std_set) {
+    ASSERT_EQ(set.size(), std_set.size());
+    std::vector<int> items(set.begin(), set.end());
+    std::vector<int> expected(std_set.begin(), std_set.end());
+    std::sort(items.begin(), items.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(items, expected);
+  }
+};
+
+TEST_F(TestUnorderedMultiset, insertAndLookup) {
+  expectSame(s21_set, std_set);
+  EXPECT_EQ(s21_set.count(2), 3U);
+  EXPECT_EQ(s21_set.count(7), 0U);
+  EXPECT_TRUE(s21_set.contains(1));
+  EXPECT_EQ(*s21_set.find(5), 5);
+  EXPECT_EQ(s21_set.find(7), s21_set.end());
+  EXPECT_EQ(*s21_set.insert(1), 1);
+  EXPECT_EQ(*s21_set.emplace(7), 7);
+  std_set.insert(1);
+  std_set.insert(7);
+  auto range = s21_set.equal_range(2);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_TRUE(std::all_of(range.first, range.second,
+                          [](int key) { return key == 2; }));
+  range = s21_set.equal_range(9);
+  EXPECT_EQ(range.first, range.second);
+  expectSame(s21_set, std_set);
+}
+
+TEST_F(TestUnorderedMultiset, eraseAndMerge) {
+  EXPECT_EQ(s21_set.erase(5), 2U);
+  EXPECT_EQ(s21_set.erase(5), 0U);
+  std_set.erase(5);
+  auto next = s21_set.erase(s21_set.find(2));
+  EXPECT_EQ(*next, 2);
+  std_set.erase(std_set.find(2));
+  expectSame(s21_set, std_set);
+
+  s21::unordered_multiset<int> other{2, 4, 4};
+  std::unordered_multiset<int> std_other{2, 4, 4};
+  s21_set.merge(other);
+  std_set.merge(std_other);
+  EXPECT_TRUE(other.empty());
+  expectSame(s21_set, std_set);
+  s21_set.clear();
+  EXPECT_EQ(s21_set.size(), 0U);
+  EXPECT_EQ(s21_set.begin(), s21_set.end());
+}
+
+TEST_F(TestUnorderedMultiset, randomOperationsMatchStd) {
+  s21::unordered_multiset<int> set;
+  std::unordered_multiset<int> reference;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 500);
+  for (int i = 0; i < 20000; ++i) {
+    int k = key(gen);
+    if (gen() % 4 == 0) {
+      auto pos = set.find(k);
+      if (pos != set.end()) {
+        set.erase(pos);
+        reference.erase(reference.find(k));
+      }
+    } else {
+      set.insert(k);
+      reference.insert(k);
+    }
+  }
+  expectSame(set, reference);
+  for (int k = 0; k <= 500; ++k) EXPECT_EQ(set.count(k), reference.count(k));
+
+  s21::unordered_multiset<int> moved(std::move(set));
+  EXPECT_EQ(set.size(), 0U);
+  s21::unordered_multiset<int> swapped;
+  swapped.swap(moved);
+  swapped.rehash(4096);
+  EXPECT_GE(swapped.bucket_count(), 4096U);
+  expectSame(swapped, reference);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "../libraries/s21_unordered_set.h"
+
+using namespace std;
+
+class TestUnorderedSet : public ::testing::Test {
+ public:
+  s21::unordered_set<string> s21_set{"Aer", "Ignis", "Terra", "Ignis"};
+  std::unordered_set<string> std_set{"Aer", "Ignis", "Terra", "Ignis"};
+
+  template <class Set, class StdSet>
+  static void expectSame(const Set &set, const StdSet &std_set) {
+    ASSERT_EQ(set.size(), std_set.size());
+    size_t visited = 0;
+    for (const auto &key : set) {
+      EXPECT_EQ(std_set.count(key), 1U);
+      ++visited;
+    }
+    EXPECT_EQ(visited, std_set.size());
+  }
+};
+
+TEST_F(TestUnorderedSet, insertAndLookup) {
+  expectSame(s21_set, std_set);
+  EXPECT_TRUE(s21_set.contains("Aer"));
+  EXPECT_FALSE(s21_set.contains("Aqua"));
+  EXPECT_EQ(*s21_set.find("Terra"), "Terra");
+  EXPECT_EQ(s21_set.find("Aqua"), s21_set.end());
+  EXPECT_EQ(s21_set.count("Ignis"), 1U);
+  EXPECT_FALSE(s21_set.insert("Aer").second);
+  auto result = s21_set.emplace(3U, 'x');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "xxx");
+  std_set.emplace(3U, 'x');
+  auto range = s21_set.equal_range("xxx");
+  EXPECT_EQ(std::distance(range.first, range.second), 1);
+  range = s21_set.equal_range("Aqua");
+  EXPECT_EQ(range.first, range.second);
+  expectSame(s21_set, std_set);
+}
+
+TEST_F(TestUnorderedSet, eraseAndMerge) {
+  EXPECT_EQ(s21_set.erase("Ignis"), 1U);
+  EXPECT_EQ(s21_set.erase("Ignis"), 0U);
+  std_set.erase("Ignis");
+  s21_set.erase(s21_set.find("Aer"));
+  std_set.erase("Aer");
+  expectSame(s21_set, std_set);
+
+  s21::unordered_set<string> other{"Terra", "Ventus"};
+  std::unordered_set<string> std_other{"Terra", "Ventus"};
+  s21_set.merge(other);
+  std_set.merge(std_other);
+  expectSame(s21_set, std_set);
+  expectSame(other, std_other);
+}
+
+TEST_F(TestUnorderedSet, randomOperationsAndRehash) {
+  s21::unordered_set<int> set;
+  std::unordered_set<int> reference;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 2000);
+  for (int i = 0; i < 20000; ++i) {
+    int k = key(gen);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(set.erase(k), reference.erase(k));
+    } else {
+      EXPECT_EQ(set.insert(k).second, reference.insert(k).second);
+    }
+  }
+  expectSame(set, reference);
+  EXPECT_LE(set.load_factor(), set.max_load_factor());
+
+  set.max_load_factor(0.5F);
+  EXPECT_LE(set.load_factor(), 0.5F);
+  set.reserve(10000);
+  EXPECT_GE(set.bucket_count() * set.max_load_factor(), 10000U);
+  expectSame(set, reference);
+  s21::unordered_set<int> moved(std::move(set));
+  EXPECT_TRUE(set.empty());
+  expectSame(moved, reference);
+}